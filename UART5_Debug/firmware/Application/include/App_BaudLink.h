@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : App_BaudLink.h
+
+  Summary     : Host negotiated change of the UART5 baud rate.
+
+  Description : The start up banner and the log always begin at
+				DRV_USART_BAUD_RATE_IDX0. A host that can keep up moves the link to a
+				faster rate with three console lines:
+
+				  BAUD=<rate>    Answered at the current rate with "BAUD OK <rate>",
+				                 or "BAUD ERR" when the rate cannot be generated. Once
+				                 the reply has left, the target switches.
+				  BAUDCHK        Sent by the host at the new rate. Answered with
+				                 "BAUDPAT " APP_BAUD_LINK_PATTERN, which the host
+				                 compares.
+				  BAUDACK        Confirms the new rate, answered with "BAUDACK OK <rate>".
+
+				Until BAUDACK arrives the new rate is on trial. A receive error, any
+				other command line or APP_BAUD_LINK_TIMEOUT_MS without BAUDACK switches
+				back to the previous rate, which is then announced with
+				"BAUD FALLBACK <rate>". So is a switch the driver refuses because the
+				transmitter did not go idle. The host tool tools/BaudLink drives the exchange.
+ ************************************************************************* */
+
+#ifndef APP_BAUDLINK_H
+#define APP_BAUDLINK_H
+
+/* ************************************************************************** */
+/* Macro Definitions                                                          */
+/* ************************************************************************** */
+
+/* Test line sent at the new rate. Alternating bits, long runs and mixed characters. */
+#define APP_BAUD_LINK_PATTERN         "UUUU****~~~~0123456789ABCDEFabcdef"
+
+#if (APP_BAUD_LINK == true)
+
+/************************************************************************************************
+Function:
+	bool AppBaudLinkCommand(const char *line);
+
+Summary:
+	Handles a console line that belongs to the rate negotiation.
+
+Description:
+	Executes BAUD=, BAUDCHK and BAUDACK. While a new rate is on trial every other line
+	is taken as a sign that the two sides do not understand each other; the link falls
+	back and the line is dropped.
+
+Parameters:
+	line : Command line without its end of line characters.
+
+Returns:
+	true when the line was consumed and must not be executed by the console.
+ ************************************************************************************************/
+bool AppBaudLinkCommand(const char *line);
+
+/************************************************************************************************
+Function:
+	void AppBaudLinkRxError(void);
+
+Summary:
+	Reports a receive error (framing, parity or overrun) seen by the console.
+
+Remarks:
+	Falls back to the previous rate when a new rate is on trial.
+ ************************************************************************************************/
+void AppBaudLinkRxError(void);
+
+/************************************************************************************************
+Function:
+	void AppBaudLinkTasks(void);
+
+Summary:
+	Switches the rate once the reply has left and runs the trial timeout.
+
+Remarks:
+	Called from the application task loop. Never blocks.
+ ************************************************************************************************/
+void AppBaudLinkTasks(void);
+
+#endif /* APP_BAUD_LINK */
+
+#endif /* APP_BAUDLINK_H */
+/* *****************************************************************************
+ End of File
+ */
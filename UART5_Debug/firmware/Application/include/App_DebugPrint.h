@@ -34,40 +34,129 @@
 #define DEBUG_COLOR_WHITE    "\x1B[37m"
 #define DEBUG_COLOR_RESET    "\x1B[0m\n\r"
 
-#define LOGGING_PRE                     \
-    unsigned char uartData[MAX_MSG_BUFF_SIZE] = { };  \
-    unsigned char uartData2[MAX_MSG_BUFF_SIZE] = { }; 
+/* Log levels, also recorded in the tokenized call site strings */
+#define APP_LOG_LEVEL_DEBUG      0
+#define APP_LOG_LEVEL_WARNING    1
+#define APP_LOG_LEVEL_ERROR      2
+#define APP_LOG_LEVEL_NONE       3
 
-#define LOGGING_WARNING(...)                                \
+/* Modules filtered independently by the runtime mask. A source file selects
+   its module by defining APP_LOG_MODULE before including app.h. */
+#define APP_LOG_MODULE_APP       0
+#define APP_LOG_MODULE_HAL       1
+#define APP_LOG_MODULE_DRV       2
+#define APP_LOG_MODULE_SYS       3
+#define APP_LOG_MODULE_COUNT     4
+
+#ifndef APP_LOG_MODULE
+#define APP_LOG_MODULE           APP_LOG_MODULE_APP
+#endif
+
+/* Runtime mask, one enable bit per module and level: bit (module * 4 + level) */
+#define APP_LOG_MASK_BIT(module, level)     (1UL << (((module) * 4U) + (level)))
+
+/* Every level from LOG_LEVEL_MIN up, for every module */
+#define APP_LOG_MASK_DEFAULT    (((0x7UL << LOG_LEVEL_MIN) & 0x7UL) * 0x1111UL)
+
+extern volatile uint32_t gAppLogMask;
+
+/* The bit is a constant at each call site, so the check is one load and test */
+#define _APP_LOG_ENABLED(level)     ((gAppLogMask & APP_LOG_MASK_BIT(APP_LOG_MODULE, level)) != 0U)
+
+/* Rate limit state of one call site */
+typedef struct APP_LOG_LIMIT_S
+{
+    /* Core timer count at the start of the current window */
+    uint32_t windowStart;
+
+    /* Messages let through in the current window */
+    uint16_t count;
+
+    /* Messages dropped since the last report */
+    uint16_t suppressed;
+
+    /* APP_LOG_LEVEL_* of the call site, its summary goes out on the same lane */
+    uint8_t level;
+
+    /* On the list of sites with a summary to report, linked through next */
+    bool listed;
+    struct APP_LOG_LIMIT_S *next;
+
+} APP_LOG_LIMIT;
+
+#if (APP_LOG_RATE_LIMIT == true)
+
+/* Window length in core timer ticks */
+#define APP_LOG_RATE_WINDOW_TICKS   ((CORE_TIMER_HZ / 1000UL) * APP_LOG_RATE_WINDOW_MS)
+
+/* Runs the statements at most APP_LOG_RATE_BURST times per window for this call site.
+   The check happens before the statements, so dropped messages are never formatted. */
+#define _APP_LOG_RATE_LIMITED(siteLevel, ...)               \
         {                                                   \
-            LOGGING_PRE;                                    \
-            sprintf(uartData2, __VA_ARGS__);               \
-            sprintf(uartData, "\n\r%s():%d:%s%s%s",        \
-            __FUNCTION__, __LINE__, DEBUG_COLOR_MAGENTA,    \
-            uartData2, DEBUG_COLOR_RESET);                 \
-            AppDebugPrint(uartData);                     \
+            static APP_LOG_LIMIT _appLogLimit =             \
+                { .level = (siteLevel) };                   \
+            if(AppLogLimitPass(&_appLogLimit))              \
+            {                                               \
+                __VA_ARGS__;                                \
+            }                                               \
         }
 
-#define LOGGING_DEBUG(...)                                 \
-        {                                                  \
-            LOGGING_PRE;                                   \
-            sprintf(uartData2, __VA_ARGS__);              \
-            sprintf(uartData, "\n\r%s():%d:%s%s%s",       \
-            __FUNCTION__, __LINE__, DEBUG_COLOR_GREEN,     \
-            uartData2, DEBUG_COLOR_RESET);                \
-            AppDebugPrint(uartData);                    \
+/* Plain prints go out on the normal lane, like debug records */
+#define APP_LOG_RATE_LIMITED(...)   _APP_LOG_RATE_LIMITED(APP_LOG_LEVEL_DEBUG, __VA_ARGS__)
+
+#else
+
+#define _APP_LOG_RATE_LIMITED(siteLevel, ...)   { __VA_ARGS__; }
+#define APP_LOG_RATE_LIMITED(...)               { __VA_ARGS__; }
+
+#endif /* APP_LOG_RATE_LIMIT */
+
+#if (APP_LOG_TOKENIZED == true)
+
+#define _APP_LOG_EMIT(level, color, ...)                    \
+        {                                                   \
+            if(_APP_LOG_ENABLED(level))                     \
+            _APP_LOG_RATE_LIMITED(level,                    \
+                _APP_LOG_TOKEN(level, __VA_ARGS__))         \
         }
 
-#define LOGGING_ERROR(...)                                 \
-        {                                                  \
-            LOGGING_PRE;                                   \
-            sprintf(uartData2, __VA_ARGS__);              \
-            sprintf(uartData, "\n\r%s():%d:%s%s%s",       \
-            __FUNCTION__, __LINE__, DEBUG_COLOR_RED,       \
-            uartData2, DEBUG_COLOR_RESET);                \
-            AppDebugPrint(uartData);                    \
+#else
+
+/* Longest formatted message of a text record, prefix and color reset not included */
+#define APP_LOG_TEXT_MAX        128U
+
+/* Longest formatted time stamp or line number part of the prefix */
+#define APP_LOG_STAMP_MAX       16U
+
+#define _APP_LOG_EMIT(level, color, ...)                    \
+        {                                                   \
+            if(_APP_LOG_ENABLED(level))                     \
+            _APP_LOG_RATE_LIMITED(level,                    \
+                AppLogText(level, color, __FUNCTION__,      \
+                __LINE__, __VA_ARGS__))                     \
         }
 
+#endif /* APP_LOG_TOKENIZED */
+
+/* Call sites below LOG_LEVEL_MIN compile to nothing, arguments included */
+#if (LOG_LEVEL_MIN <= APP_LOG_LEVEL_WARNING)
+#define LOGGING_WARNING(...)    _APP_LOG_EMIT(APP_LOG_LEVEL_WARNING, DEBUG_COLOR_MAGENTA, __VA_ARGS__)
+#else
+#define LOGGING_WARNING(...)    { }
+#endif
+
+#if (LOG_LEVEL_MIN <= APP_LOG_LEVEL_DEBUG)
+#define LOGGING_DEBUG(...)      _APP_LOG_EMIT(APP_LOG_LEVEL_DEBUG, DEBUG_COLOR_GREEN, __VA_ARGS__)
+#else
+#define LOGGING_DEBUG(...)      { }
+#endif
+
+#if (LOG_LEVEL_MIN <= APP_LOG_LEVEL_ERROR)
+#define LOGGING_ERROR(...)      _APP_LOG_EMIT(APP_LOG_LEVEL_ERROR, DEBUG_COLOR_RED, __VA_ARGS__)
+#else
+#define LOGGING_ERROR(...)      { }
+#endif
+
 /************************************************************************************************
 Function:  
 	int8_t AppDebugPrint(char *uartBuffer);
@@ -79,8 +168,9 @@ Description:
 	This function takes a debug string (`debugBuffer`), checks if the buffer pointer is valid, 
 	and attempts to send the string through UART for debugging purposes. 
 	The function first ensures that the `debugBuffer` is not NULL. If the buffer is valid,
-	it calculates the length of the string and attempts to print it using the `UartWritePacket` function. 
-	If the UART print operation is successful, it returns `SUCCESS`; otherwise,
+	it calculates the length of the string and copies it into the UART transmit ring using the
+	`UartWriteQueued` function, which returns without waiting for the wire.
+	If the string was queued, it returns `SUCCESS`; otherwise,
 	it returns the error code from the UART print function. If the buffer pointer is NULL, 
 	it returns an invalid pointer error.
 
@@ -88,20 +178,212 @@ Parameters:
 	debugBuffer[]: A null-terminated string to be sent over UART for debugging output.
 
 Returns:  
-	- SUCCESS: The string was successfully sent via UART.
+	- SUCCESS: The string was queued for transmission via UART.
 	- e_ERROR_UART_INVALID_POINTER: The input debugBuffer was NULL.
-	- Any other error code from UartWritePacket in case of failure.
+	- Any other error code from UartWriteQueued in case of failure.
 
 Remarks:  
 	This function is typically used for debugging purposes in embedded systems 
 	where UART communication is used to print log messages or debug information.
 	It ensures that invalid input pointers are properly handled, and 
 	any issues with UART communication are reported.
-	The function depends on the `UartWritePacket` function to handle the actual transmission of data over UART.
+	The function depends on the `UartWriteQueued` function to hand the data to the UART driver.
 
  ************************************************************************************************/
 int8_t AppDebugPrint(char *uartBuffer);
 
+#if (APP_LOG_TOKENIZED == false)
+/************************************************************************************************
+Function:  
+	int8_t AppLogText(uint8_t level, const char *color, const char *function, int line, const char *format, ...);
+
+Summary:  
+	Formats one LOGGING_* record in a single pass and queues it for UART transmission.
+
+Description:  
+	Room for the longest possible record is reserved in the transmit ring with UartTxReserve,
+	and the "[+ticks]function():line:" prefix, the color code, the message and the color reset
+	are written into it in order, then committed as one record. Nothing is staged on the
+	stack. A message longer than APP_LOG_TEXT_MAX is cut short; the color reset is always kept.
+
+Parameters:  
+	level    : Level of the call site. APP_LOG_LEVEL_ERROR records go to the high priority
+	           transmit lane, the others to the normal lane.
+	color    : Escape sequence selecting the level color.
+	function : Name of the calling function.
+	line     : Source line of the call site.
+	format   : printf style format string followed by its arguments.
+
+Returns:  
+	- SUCCESS: The record was queued for transmission.
+	- e_ERROR_UART_TX_RING_FULL: The lane had no room, the record was dropped.
+	- Any other error code from UartTxCommit in case of failure.
+
+Remarks:  
+	Normally called only through the LOGGING_* macros.
+ ************************************************************************************************/
+int8_t AppLogText(uint8_t level, const char *color, const char *function, int line, const char *format, ...);
+
+#endif
+
+/************************************************************************************************
+Function:  
+	int8_t AppDebugPrintf(const char *format, ...);
+
+Summary:  
+	Formats a message directly into the UART transmit ring and queues it.
+
+Description:  
+	Reserves BUFFER_SIZE bytes with UartTxReserve, formats the message there with AppFormatV
+	and commits what was written. Replaces the pattern of formatting into a stack buffer
+	and copying it with AppDebugPrint.
+
+Parameters:  
+	format : printf style format string followed by its arguments, see AppFormat.
+
+Returns:  
+	- SUCCESS: The message was queued for transmission.
+	- e_ERROR_UART_INVALID_POINTER: format was NULL.
+	- e_ERROR_UART_TX_RING_FULL: The ring had no room, the message was dropped.
+	- Any other error code from UartTxCommit in case of failure.
+
+Remarks:  
+	Output beyond BUFFER_SIZE - 1 characters is cut off.
+ ************************************************************************************************/
+int8_t AppDebugPrintf(const char *format, ...);
+
+/************************************************************************************************
+Function:  
+	uint64_t AppLogStampDelta(void);
+
+Summary:  
+	Returns the core timer ticks since the previous log record and starts a new interval.
+
+Description:  
+	Every LOGGING_* record carries this delta instead of a formatted time, "[+ticks]" in
+	text mode and a varint in tokenized mode. The first record carries the ticks since
+	reset, so the host can rebuild absolute times by adding the deltas up. One tick is
+	two system clocks, see CORE_TIMER_HZ. Callers take it only once the room for the
+	record is granted, so a dropped record leaves its interval to the next one.
+
+Returns:  
+	Ticks since the previous call.
+ ************************************************************************************************/
+uint64_t AppLogStampDelta(void);
+
+#if (APP_LOG_RATE_LIMIT == true)
+/************************************************************************************************
+Function:  
+	bool AppLogLimitPass(APP_LOG_LIMIT *limit);
+
+Summary:  
+	Decides whether one call site may emit another message in its current window.
+
+Description:  
+	Each call site may emit APP_LOG_RATE_BURST messages per APP_LOG_RATE_WINDOW_MS. Later
+	messages in the same window are only counted, and the site is put on the list
+	AppLogLimitTasks reports from. When the window has ended, a "last message repeated N
+	times" line is sent by AppLogLimitTasks, or ahead of the site's next message if that
+	comes first. A site that repeats on every pass collapses to a burst plus one summary
+	per window, and the count of a site that went quiet is not lost.
+
+Parameters:  
+	limit: Rate limit state owned by the call site.
+
+Returns:  
+	true when the message may be formatted and sent, false when it is dropped.
+
+Remarks:  
+	Normally used through APP_LOG_RATE_LIMITED, which is part of every LOGGING_* macro.
+ ************************************************************************************************/
+bool AppLogLimitPass(APP_LOG_LIMIT *limit);
+
+/************************************************************************************************
+Function:  
+	void AppLogLimitTasks(void);
+
+Summary:  
+	Reports the dropped message count of every call site whose window has ended.
+
+Description:  
+	The "last message repeated N times" line goes out on the lane of the site's level: the
+	high priority lane for errors, the normal lane otherwise. A line the lane cannot take
+	is retried on the next call.
+
+Remarks:  
+	Called from the application task loop.
+ ************************************************************************************************/
+void AppLogLimitTasks(void);
+
+#endif
+
+/************************************************************************************************
+Function:  
+	void AppLogLevelSet(uint8_t level);
+
+Summary:  
+	Changes the runtime log threshold of every module.
+
+Description:  
+	Rewrites the log mask so that call sites at or above `level` are emitted in all modules.
+	Levels below LOG_LEVEL_MIN produce nothing whatever the mask says, because those call sites
+	are not compiled into the image.
+
+Parameters:  
+	level: One of APP_LOG_LEVEL_DEBUG, APP_LOG_LEVEL_WARNING, APP_LOG_LEVEL_ERROR or APP_LOG_LEVEL_NONE.
+
+Returns:  
+	None.
+ ************************************************************************************************/
+void AppLogLevelSet(uint8_t level);
+
+/************************************************************************************************
+Function:  
+	void AppLogMaskSet(uint32_t mask);
+
+Summary:  
+	Replaces the per-module, per-level log mask.
+
+Description:  
+	Bit (module * 4 + level) enables one level of one module, see APP_LOG_MASK_BIT.
+	Bits that do not belong to a module and level are cleared.
+
+Parameters:  
+	mask: New log mask.
+
+Returns:  
+	None.
+ ************************************************************************************************/
+void AppLogMaskSet(uint32_t mask);
+
+/************************************************************************************************
+Function:  
+	uint32_t AppLogMaskGet(void);
+
+Summary:  
+	Returns the current per-module, per-level log mask.
+ ************************************************************************************************/
+uint32_t AppLogMaskGet(void);
+
+#if (APP_LOG_PROFILE == true)
+/************************************************************************************************
+Function:  
+	void AppLogProfile(void);
+
+Summary:  
+	Reports the cost of one LOGGING_* call per level over UART.
+
+Description:  
+	Each macro is timed with the core timer, which counts at half the system clock, and
+	the result is printed in CPU cycles. Levels removed by LOG_LEVEL_MIN report the cost
+	of an empty call site.
+
+Returns:  
+	None.
+ ************************************************************************************************/
+void AppLogProfile(void);
+#endif
+
 #endif /* APP_DEBUGPRINT_H */
 /* *****************************************************************************
  End of File
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : App_Format.h
+
+  Summary     : Small integer-only printf style formatter for the debug output.
+
+  Description : `AppFormat` and `AppFormatV` replace newlib's sprintf on the
+				logging path. They support the conversions the firmware needs:
+
+				  %d %i %u %x %X %s %c %p %%
+
+				with the '-' and '0' flags, a field width, a precision for %s,
+				and the 'l' and 'h' length modifiers (ignored, int is 32 bits).
+				%f is only available when APP_FORMAT_FLOAT_SUPPORT is true.
+				Output is always bounded by the buffer size and NUL terminated.
+ ************************************************************************* */
+
+#ifndef APP_FORMAT_H
+#define APP_FORMAT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+
+/************************************************************************************************
+Function:
+	int AppFormat(char *buffer, size_t size, const char *format, ...);
+
+Summary:
+	Formats into `buffer`, writing at most `size` bytes including the terminating NUL.
+
+Parameters:
+	buffer : Destination buffer.
+	size   : Size of `buffer` in bytes.
+	format : Format string followed by its arguments.
+
+Returns:
+	Number of characters written, not counting the NUL. Unlike snprintf this is the
+	length actually stored, so a truncated result never exceeds size - 1.
+ ************************************************************************************************/
+int AppFormat(char *buffer, size_t size, const char *format, ...);
+
+/************************************************************************************************
+Function:
+	int AppFormatV(char *buffer, size_t size, const char *format, va_list args);
+
+Summary:
+	va_list variant of AppFormat.
+ ************************************************************************************************/
+int AppFormatV(char *buffer, size_t size, const char *format, va_list args);
+
+#endif /* APP_FORMAT_H */
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : App_LogConsole.h
+
+  Summary     : Line based UART5 console for changing the log mask at run time.
+
+  Description : Commands are read in place from the USART driver receive ring
+				(DRV_USART0_Read without it) and end with CR or LF:
+
+				  LOGMASK?              Reports the current mask.
+				  LOGMASK=<hex>         Replaces the mask and reports the result.
+				  LOGLEVEL=<0..3>       Sets the same level threshold for every module.
+				  USARTSTAT?            Reports the USART5 driver counters as
+				                        "USARTSTAT key=value ..." lines (DRV_USART_STATISTICS).
+				  ISRSTAT?              Reports the UART5 ISR latency and body time in
+				                        system clock cycles (DRV_USART_ISR_PROFILE).
+				  BAUD?                 Reports the UART5 baud rate, the rate actually
+				                        generated and the error in percent.
+				  BAUD=, BAUDCHK,       Rate negotiation with the host, see App_BaudLink.h
+				  BAUDACK               (APP_BAUD_LINK).
+
+				Mask bit (module * 4 + level) enables one level of one module,
+				see APP_LOG_MASK_BIT in App_DebugPrint.h.
+ ************************************************************************* */
+
+#ifndef APP_LOGCONSOLE_H
+#define APP_LOGCONSOLE_H
+
+/* ************************************************************************** */
+/* Macro Definitions                                                          */
+/* ************************************************************************** */
+#define APP_LOG_CONSOLE_LINE_MAX      24U     /* Longest accepted command line */
+#define APP_LOG_CONSOLE_RX_CHUNK      9U      /* Bytes read per call, RX FIFO + shift register */
+
+/************************************************************************************************
+Function:
+	void AppLogConsoleTasks(void);
+
+Summary:
+	Reads pending console bytes and executes every completed command line.
+
+Description:
+	The function never blocks. Bytes are collected until CR or LF, then the line is
+	matched against the supported commands and a reply is queued on the debug UART.
+	Lines longer than APP_LOG_CONSOLE_LINE_MAX are discarded.
+
+Returns:
+	None.
+
+Remarks:
+	Called from the application task loop.
+ ************************************************************************************************/
+void AppLogConsoleTasks(void);
+
+#endif /* APP_LOGCONSOLE_H */
+/* *****************************************************************************
+ End of File
+ */
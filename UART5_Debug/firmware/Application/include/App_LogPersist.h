@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : App_LogPersist.h
+
+  Summary     : Log ring kept in RAM that the startup code does not clear.
+
+  Description : Every log record sent over UART is also copied into a ring in
+				the `persistent` RAM section, protected by a magic number and a
+				checksum. After a reset `AppLogPersistInitialize` (called from
+				SYS_Initialize) checks the ring, and when it survived the
+				application streams it out on the high priority UART lane
+				before the start up banner.
+ ************************************************************************* */
+
+#ifndef APP_LOGPERSIST_H
+#define APP_LOGPERSIST_H
+
+/* ************************************************************************** */
+/* Macro Definitions                                                          */
+/* ************************************************************************** */
+#define APP_LOG_PERSIST_MAGIC         0x4C4F4732UL    /* "LOG2", length prefixed records */
+#define APP_LOG_PERSIST_LINE_MAX      64U             /* Marker and exception lines */
+#define APP_LOG_PERSIST_RECORD_MAX    (MAX_FRAME_SIZE - 1U)   /* Longer records are cut */
+
+#if (APP_LOG_PERSIST == true)
+
+/************************************************************************************************
+Function:
+	void AppLogPersistInitialize(void);
+
+Summary:
+	Checks whether the persistent log ring survived the last reset.
+
+Description:
+	The ring is kept when its magic number and checksum are intact; its content is then
+	marked for replay and new records are not stored until the replay is done. Otherwise,
+	after a power on for example, the ring is cleared. The reset cause flags of RCON are
+	read for the replay start marker and then cleared, so the next reset reports only
+	its own cause.
+
+Returns:
+	None.
+
+Remarks:
+	Called from SYS_Initialize before the application is initialized.
+ ************************************************************************************************/
+void AppLogPersistInitialize(void);
+
+/************************************************************************************************
+Function:
+	void AppLogPersistWrite(const char *record, size_t length);
+
+Summary:
+	Appends one log record to the persistent ring, dropping the oldest records whole.
+
+Description:
+	The record is stored behind its length, so that the replay can send it back in one
+	piece. Only the first APP_LOG_PERSIST_RECORD_MAX bytes of a longer record are kept.
+
+Parameters:
+	record : Record exactly as it is sent over UART.
+	length : Number of bytes in the record.
+
+Returns:
+	None.
+ ************************************************************************************************/
+void AppLogPersistWrite(const char *record, size_t length);
+
+/************************************************************************************************
+Function:
+	bool AppLogPersistReplayPending(void);
+
+Summary:
+	Returns true while records from before the last reset are waiting to be replayed.
+ ************************************************************************************************/
+bool AppLogPersistReplayPending(void);
+
+/************************************************************************************************
+Function:
+	bool AppLogPersistReplayTasks(void);
+
+Summary:
+	Streams the surviving records out on the high priority UART lane.
+
+Description:
+	Sends one record per call, framed by start and end marker lines. The start marker
+	carries the RCON reset cause. Each record goes into a reservation of its own, so a
+	live record sent on the high priority lane meanwhile can only come out between two
+	replayed records, never inside one. A record the lane cannot take is retried on the
+	next call. When the replay is complete the ring is cleared and
+	starts recording the new session.
+
+Returns:
+	true when the replay is complete.
+
+Remarks:
+	Called from the application task loop before the start up banner.
+ ************************************************************************************************/
+bool AppLogPersistReplayTasks(void);
+
+/************************************************************************************************
+Function:
+	void AppLogPersistException(uint32_t cause, uint32_t address);
+
+Summary:
+	Records a general exception in the persistent ring.
+
+Remarks:
+	Called from _general_exception_handler, so that the exception is replayed after the
+	next reset even when nothing was listening on UART5 at the time.
+ ************************************************************************************************/
+void AppLogPersistException(uint32_t cause, uint32_t address);
+
+#endif /* APP_LOG_PERSIST */
+
+#endif /* APP_LOGPERSIST_H */
+/* *****************************************************************************
+ End of File
+ */
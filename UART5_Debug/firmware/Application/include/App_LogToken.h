@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : App_LogToken.h
+
+  Summary     : Tokenized (deferred format) variant of the LOGGING_* macros.
+
+  Description : In tokenized mode a log call site does not format anything on
+				the target. The level, file, line and format string of each call
+				site are placed in the non-loaded `.app_log_sites` ELF section,
+				and only a compact binary record is sent over UART:
+
+				  0xA5 | length | varint(site id) | varint(delta) | varint(arg)...
+
+				The delta is the number of core timer ticks since the previous
+				log record, see AppLogStampDelta.
+
+				The site id is the offset of the call site string inside
+				`.app_log_sites`. The host tool LogDecoder reads that section
+				from the ELF file and expands the records back to text.
+ ************************************************************************* */
+
+#ifndef APP_LOGTOKEN_H
+#define APP_LOGTOKEN_H
+
+/* ************************************************************************** */
+/* Macro Definitions                                                          */
+/* ************************************************************************** */
+#define APP_LOG_TOKEN_SYNC            0xA5U   /* First byte of every record */
+#define APP_LOG_TOKEN_ARGS_MAX        8U      /* Arguments per call site */
+#define APP_LOG_TOKEN_RECORD_MAX      64U     /* Sync + length + payload */
+#define APP_LOG_TOKEN_FIELD_SEP       "\x1F"  /* Separator inside a site string */
+
+#define _APP_LOG_STR_(x)              #x
+#define _APP_LOG_STR(x)               _APP_LOG_STR_(x)
+
+/* Number of arguments following the format string, 0 to APP_LOG_TOKEN_ARGS_MAX */
+#define _APP_LOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, _7, _8, N, ...)  N
+#define _APP_LOG_NARGS(...)                                             \
+        _APP_LOG_NARGS_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+
+/*
+ * Emits one tokenized record. Only integer, character and pointer arguments
+ * are supported; each one is sent as a 32-bit varint.
+ */
+#define _APP_LOG_TOKEN(level, fmt, ...)                                     \
+        {                                                                   \
+            static const char _appLogSite[]                                 \
+                __attribute__((section(".app_log_sites"), used)) =          \
+                _APP_LOG_STR(level) APP_LOG_TOKEN_FIELD_SEP                 \
+                __FILE__ APP_LOG_TOKEN_FIELD_SEP                            \
+                _APP_LOG_STR(__LINE__) APP_LOG_TOKEN_FIELD_SEP fmt;         \
+            AppLogTokenWrite(level, (uint32_t)(uintptr_t)_appLogSite,       \
+                _APP_LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__);                \
+        }
+
+/************************************************************************************************
+Function:
+	int8_t AppLogTokenWrite(uint8_t level, uint32_t siteId, uint8_t argCount, ...);
+
+Summary:
+	Encodes one tokenized log record and queues it for UART transmission.
+
+Description:
+	The site id, the ticks since the previous record and every argument are varint encoded into a record
+	prefixed with APP_LOG_TOKEN_SYNC and the payload length. The record is encoded
+	straight into room reserved with UartTxReserve or UartTxReserveHigh, and the
+	delta is only taken once that room is granted.
+
+Parameters:
+	level    : Level of the call site, APP_LOG_LEVEL_ERROR records use the high priority lane.
+	siteId   : Offset of the call site string inside `.app_log_sites`.
+	argCount : Number of 32-bit arguments that follow, at most APP_LOG_TOKEN_ARGS_MAX.
+
+Returns:
+	- SUCCESS: The record was queued for transmission.
+	- e_ERROR_BUFFER_SIZE_INVALID: argCount exceeds APP_LOG_TOKEN_ARGS_MAX.
+	- e_ERROR_UART_TX_RING_FULL: The ring had no room, the record was dropped.
+	- Any other error code from UartTxCommit in case of failure.
+
+Remarks:
+	Normally called only through the LOGGING_* macros.
+ ************************************************************************************************/
+int8_t AppLogTokenWrite(uint8_t level, uint32_t siteId, uint8_t argCount, ...);
+
+#endif /* APP_LOGTOKEN_H */
+/* *****************************************************************************
+ End of File
+ */
@@ -33,13 +33,20 @@
 #define BUFFER_SIZE              100
 #define MAX_FRAME_SIZE          200
 #define MAX_MSG_BUFF_SIZE       100U
-#define UART_WRITE_TIMEOUT    60000U
+#define UART_WRITE_TIMEOUT_US 250000U /* MAX_FRAME_SIZE bytes take 208 ms at 9600 baud */
 
 /* ************************************************************************** */
 /* Included Modules                                                           */
 /* ************************************************************************** */
+#include "../include/App_Format.h"
 #include "../include/App_DebugPrint.h"
+#include "../include/App_LogToken.h"
+#include "../include/App_LogConsole.h"
+#include "../include/App_LogPersist.h"
+#include "../include/App_BaudLink.h"
 #include "../../HAL/include/HAL_UartPrint.h"
+#include "../../HAL/include/HAL_UartStream.h"
+#include "../../HAL/include/HAL_CoreTimer.h"
 
 #endif /* APP_UART_INCLUDE_H */
 
@@ -0,0 +1,246 @@
+/* ************************************************************************** */
+/*
+  Company    : BTC POWER.
+
+  Author	 : Krushna C
+
+  Created    : 17 October 2026
+
+  File Name  : App_BaudLink.c
+
+  Summary    : Host negotiated change of the UART5 baud rate.
+
+  Description: This file contains the target side of the BAUD= / BAUDCHK /
+    BAUDACK exchange described in App_BaudLink.h. A rate change is only made
+    permanent when the host has read the test pattern at the new rate and
+    confirmed it; every other outcome returns to the last confirmed rate.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app.h"
+
+#if (APP_BAUD_LINK == true)
+
+
+/* Section: Data Types                                                        */
+
+/* Negotiation progress */
+typedef enum
+{
+    APP_BAUD_LINK_IDLE = 0,
+    APP_BAUD_LINK_SWITCH,
+    APP_BAUD_LINK_TRIAL
+} APP_BAUD_LINK_STATE;
+
+
+/* Section: File Scope Data                                                   */
+
+static APP_BAUD_LINK_STATE baudLinkState = APP_BAUD_LINK_IDLE;
+
+/* Rate to switch to in APP_BAUD_LINK_SWITCH */
+static uint32_t baudLinkRate = RESET;
+
+/* Last rate confirmed by the host, the fall back target */
+static uint32_t baudLinkConfirmed = RESET;
+
+/* True when the pending switch returns to baudLinkConfirmed */
+static bool baudLinkFallingBack = false;
+
+/* End of the trial */
+static CORE_TIMER_TIMEOUT baudLinkTrial;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:
+    static void AppBaudLinkFallBack(void);
+
+Summary:
+    Schedules the switch back to the last confirmed rate.
+ ************************************************************************************************/
+static void AppBaudLinkFallBack(void)
+{
+    baudLinkRate = baudLinkConfirmed;
+    baudLinkFallingBack = true;
+    baudLinkState = APP_BAUD_LINK_SWITCH;
+}
+
+/************************************************************************************************
+Function:
+    static void AppBaudLinkRequest(const char *text);
+
+Summary:
+    Accepts or rejects the rate in a BAUD=<rate> line.
+
+Remarks:
+    The reply is queued at the current rate; the switch waits in AppBaudLinkTasks until it
+    has left the transmit ring.
+ ************************************************************************************************/
+static void AppBaudLinkRequest(const char *text)
+{
+    DRV_USART_BAUD_STATUS baud;
+    char *end;
+    unsigned long rate;
+
+    rate = strtoul(text, &end, 10);
+    if((end == text) || (*end != '\0') || (rate > UINT32_MAX) ||
+       (DRV_USART0_BaudCheck((uint32_t)rate) != DRV_USART_BAUD_SET_SUCCESS))
+    {
+        AppDebugPrint("\r\nBAUD ERR\r\n");
+        return;
+    }
+
+    DRV_USART0_BaudStatusGet(&baud);
+    baudLinkConfirmed = baud.requested;
+    baudLinkRate = (uint32_t)rate;
+    baudLinkFallingBack = false;
+    baudLinkState = APP_BAUD_LINK_SWITCH;
+
+    AppDebugPrintf("\r\nBAUD OK %lu\r\n", rate);
+}
+
+
+/* Section: Interface Functions                                               */
+
+/************************************************************************************************
+Function:
+    bool AppBaudLinkCommand(const char *line);
+
+Remarks:
+    See prototype in App_BaudLink.h.
+ ************************************************************************************************/
+bool AppBaudLinkCommand(const char *line)
+{
+    if(baudLinkState == APP_BAUD_LINK_SWITCH)
+    {
+        /* Sent before the switch, at a rate that is about to change */
+        return true;
+    }
+
+    if(strcmp(line, "BAUDCHK") == 0)
+    {
+        AppDebugPrint("\r\nBAUDPAT " APP_BAUD_LINK_PATTERN "\r\n");
+        return true;
+    }
+
+    if(strcmp(line, "BAUDACK") == 0)
+    {
+        if(baudLinkState == APP_BAUD_LINK_TRIAL)
+        {
+            baudLinkConfirmed = baudLinkRate;
+            baudLinkState = APP_BAUD_LINK_IDLE;
+        }
+
+        /* Also answered when idle, in case the host missed the first answer */
+        AppDebugPrintf("\r\nBAUDACK OK %lu\r\n", (unsigned long)baudLinkConfirmed);
+        return true;
+    }
+
+    if(baudLinkState == APP_BAUD_LINK_TRIAL)
+    {
+        /* Garbled or unexpected line, the new rate does not work */
+        AppBaudLinkFallBack();
+        return true;
+    }
+
+    if(strncmp(line, "BAUD=", 5) == 0)
+    {
+        AppBaudLinkRequest(&line[5]);
+        return true;
+    }
+
+    return false;
+}
+
+/************************************************************************************************
+Function:
+    void AppBaudLinkRxError(void);
+
+Remarks:
+    See prototype in App_BaudLink.h.
+ ************************************************************************************************/
+void AppBaudLinkRxError(void)
+{
+    if(baudLinkState == APP_BAUD_LINK_TRIAL)
+    {
+        AppBaudLinkFallBack();
+    }
+}
+
+/************************************************************************************************
+Function:
+    void AppBaudLinkTasks(void);
+
+Remarks:
+    See prototype in App_BaudLink.h.
+ ************************************************************************************************/
+void AppBaudLinkTasks(void)
+{
+    DRV_USART_BAUD_SET_RESULT baudSetResult;
+
+    switch(baudLinkState)
+    {
+        case APP_BAUD_LINK_SWITCH:
+        {
+#if (DRV_USART_TX_RING_SUPPORT == true)
+            /* The reply must leave at the rate the host is listening on */
+            if(!DRV_USART0_TxRingIsEmpty())
+            {
+                break;
+            }
+#endif
+            baudSetResult = DRV_USART0_BaudSet(baudLinkRate);
+            if(baudSetResult != DRV_USART_BAUD_SET_SUCCESS)
+            {
+                baudLinkRate = baudLinkConfirmed;
+                baudLinkFallingBack = true;
+
+                /* A timeout leaves the old rate set. The rate was checked when the
+                   request was accepted, so only a clock change gets an error. */
+                if(baudSetResult != DRV_USART_BAUD_SET_TIMEOUT)
+                {
+                    (void)DRV_USART0_BaudSet(baudLinkRate);
+                }
+            }
+
+            if(baudLinkFallingBack)
+            {
+                AppDebugPrintf("\r\nBAUD FALLBACK %lu\r\n", (unsigned long)baudLinkRate);
+                baudLinkState = APP_BAUD_LINK_IDLE;
+            }
+            else
+            {
+                CoreTimerTimeoutStart(&baudLinkTrial, (uint32_t)APP_BAUD_LINK_TIMEOUT_MS * 1000U);
+                baudLinkState = APP_BAUD_LINK_TRIAL;
+            }
+            break;
+        }
+
+        case APP_BAUD_LINK_TRIAL:
+        {
+            if(CoreTimerTimeoutExpired(&baudLinkTrial))
+            {
+                AppBaudLinkFallBack();
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+#endif /* APP_BAUD_LINK */
+
+/* *****************************************************************************
+ End of File -:  App_BaudLink.c
+ */
@@ -24,9 +24,65 @@ Description  : This file primarily includes the function `AppDebugPrint`, which
 /* Section: Included Files                                                    */
 #include <stdint.h>
 #include <stdbool.h>
+#include <stdarg.h>
+#include <string.h>
+#include <xc.h>
 #include "app.h"
 
 
+/* Section: Global Data                                                      */
+
+/* Per-module, per-level enable bits checked by the LOGGING_* macros */
+volatile uint32_t gAppLogMask = APP_LOG_MASK_DEFAULT;
+
+/* Core timer time of the previous log record */
+static uint64_t appLogLastStamp = RESET;
+
+#if (APP_LOG_RATE_LIMIT == true)
+/* Longest "last message repeated N times" line */
+#define APP_LOG_LIMIT_LINE_MAX      40
+
+/* Call sites with dropped messages not reported yet */
+static APP_LOG_LIMIT *appLogLimitList = NULL;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:  
+    static bool AppLogLimitReport(APP_LOG_LIMIT *limit);
+
+Summary:  
+    Sends the summary of a call site on the lane of its level and clears its count.
+
+Returns:  
+    false when the lane has no room, the count is then kept.
+ ************************************************************************************************/
+static bool AppLogLimitReport(APP_LOG_LIMIT *limit)
+{
+    char *record;
+    int length;
+
+    record = (limit->level == APP_LOG_LEVEL_ERROR) ? UartTxReserveHigh(APP_LOG_LIMIT_LINE_MAX) :
+                                                     UartTxReserve(APP_LOG_LIMIT_LINE_MAX);
+    if(record == NULL)
+    {
+        return false;
+    }
+
+    length = AppFormat(record, APP_LOG_LIMIT_LINE_MAX, "\r\nlast message repeated %u times\r\n",
+                       (unsigned)limit->suppressed);
+#if (APP_LOG_PERSIST == true)
+    AppLogPersistWrite(record, (size_t)length);
+#endif
+    (void)UartTxCommit(length);
+
+    limit->suppressed = RESET;
+    return true;
+}
+#endif
+
+
 /* Section: Interface Functions                                         */
 
 /************************************************************************************************
@@ -40,8 +96,9 @@ Description:
     This function takes a debug string (`debugBuffer`), checks if the buffer pointer is valid, 
     and attempts to send the string through UART for debugging purposes. 
     The function first ensures that the `debugBuffer` is not NULL. If the buffer is valid,
-    it calculates the length of the string and attempts to print it using the `UartWritePacket` function. 
-    If the UART print operation is successful, it returns `SUCCESS`; otherwise,
+    it calculates the length of the string and copies it into the UART transmit ring using the
+    `UartWriteQueued` function, which returns without waiting for the wire.
+    If the string was queued, it returns `SUCCESS`; otherwise,
     it returns the error code from the UART print function. If the buffer pointer is NULL, 
     it returns an invalid pointer error.
 
@@ -49,22 +106,22 @@ Parameters:
     debugBuffer[]: A null-terminated string to be sent over UART for debugging output.
 
 Returns:  
-    - SUCCESS: The string was successfully sent via UART.
+    - SUCCESS: The string was queued for transmission via UART.
     - e_ERROR_UART_INVALID_POINTER: The input debugBuffer was NULL.
-    - Any other error code from UartWritePacket in case of failure.
+    - Any other error code from UartWriteQueued in case of failure.
 
 Remarks:  
     This function is typically used for debugging purposes in embedded systems 
     where UART communication is used to print log messages or debug information.
     It ensures that invalid input pointers are properly handled, and 
     any issues with UART communication are reported.
-    The function depends on the `UartWritePacket` function to handle the actual transmission of data over UART.
+    The function depends on the `UartWriteQueued` function to hand the data to the UART driver.
 
  ************************************************************************************************/
 int8_t AppDebugPrint(char *uartBuffer)
 {
     int8_t status = SUCCESS;
-    uint8_t writeCount = RESET;
+    size_t writeCount = RESET;
 
     if(uartBuffer == NULL) //buffer data is NULL or not?
     {
@@ -79,13 +136,276 @@ int8_t AppDebugPrint(char *uartBuffer)
         }
         else
         {
-            status = UartWritePacket(uartBuffer,writeCount);//status value update with UartWritePacket
+            status = UartWriteQueued(uartBuffer,(int)writeCount);//queue the string and return, the driver drains it
 
         }
     }
     return status;
 }
 
+#if (APP_LOG_TOKENIZED == false)
+/************************************************************************************************
+Function:  
+    int8_t AppLogText(uint8_t level, const char *color, const char *function, int line, const char *format, ...);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+int8_t AppLogText(uint8_t level, const char *color, const char *function, int line, const char *format, ...)
+{
+    static const char colorReset[] = DEBUG_COLOR_RESET;
+    const size_t functionLength = strlen(function);
+    const size_t colorLength = strlen(color);
+    /* Longest record this call site can produce */
+    const int recordMax = (int)((2U * APP_LOG_STAMP_MAX) + functionLength + colorLength +
+                                APP_LOG_TEXT_MAX + (sizeof(colorReset) - 1U));
+    uint64_t delta;
+    char *record;
+    size_t length;
+    va_list args;
+
+    /* Errors overtake any debug traffic already queued */
+    record = (level == APP_LOG_LEVEL_ERROR) ? UartTxReserveHigh(recordMax) : UartTxReserve(recordMax);
+    if(record == NULL)
+    {
+        /* Counted as a dropped record by the driver. The interval is not
+           restarted, so the next record's delta still covers this one. */
+        return e_ERROR_UART_TX_RING_FULL;
+    }
+
+    delta = AppLogStampDelta();
+
+    /* Gaps over 2^32 ticks (107 s) are not latencies worth measuring, saturate them */
+    if(delta > 0xFFFFFFFFULL)
+    {
+        delta = 0xFFFFFFFFULL;
+    }
+
+    /* The record is formatted straight into the transmit ring. AppFormat keeps its
+       NUL within the bound, the next part overwrites it. */
+    length = (size_t)AppFormat(record, APP_LOG_STAMP_MAX, "\n\r[+%lu]", (unsigned long)delta);
+    memcpy(&record[length], function, functionLength);
+    length += functionLength;
+    length += (size_t)AppFormat(&record[length], APP_LOG_STAMP_MAX, "():%d:", line);
+    memcpy(&record[length], color, colorLength);
+    length += colorLength;
+
+    va_start(args, format);
+    length += (size_t)AppFormatV(&record[length], APP_LOG_TEXT_MAX, format, args);
+    va_end(args);
+
+    memcpy(&record[length], colorReset, sizeof(colorReset) - 1U);
+    length += sizeof(colorReset) - 1U;
+
+#if (APP_LOG_PERSIST == true)
+    AppLogPersistWrite(record, length);
+#endif
+
+    return UartTxCommit((int)length);
+}
+#endif
+
+/************************************************************************************************
+Function:  
+    int8_t AppDebugPrintf(const char *format, ...);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+int8_t AppDebugPrintf(const char *format, ...)
+{
+    char *record;
+    int length;
+    va_list args;
+
+    if(format == NULL)
+    {
+        return e_ERROR_UART_INVALID_POINTER;
+    }
+
+    record = UartTxReserve(BUFFER_SIZE);
+    if(record == NULL)
+    {
+        return e_ERROR_UART_TX_RING_FULL;
+    }
+
+    va_start(args, format);
+    length = AppFormatV(record, BUFFER_SIZE, format, args);
+    va_end(args);
+
+    return UartTxCommit(length);
+}
+
+/************************************************************************************************
+Function:  
+    uint64_t AppLogStampDelta(void);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+uint64_t AppLogStampDelta(void)
+{
+    return CoreTimerDeltaGet(&appLogLastStamp);
+}
+
+#if (APP_LOG_RATE_LIMIT == true)
+/************************************************************************************************
+Function:  
+    bool AppLogLimitPass(APP_LOG_LIMIT *limit);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+bool AppLogLimitPass(APP_LOG_LIMIT *limit)
+{
+    uint32_t now = _CP0_GET_COUNT();
+
+    if((now - limit->windowStart) >= APP_LOG_RATE_WINDOW_TICKS)
+    {
+        /* AppLogLimitTasks has not reported it yet. A summary the lane cannot
+           take now is counted on into the new window. */
+        if(limit->suppressed > ZERO)
+        {
+            (void)AppLogLimitReport(limit);
+        }
+        limit->windowStart = now;
+        limit->count = RESET;
+    }
+
+    if(limit->count < APP_LOG_RATE_BURST)
+    {
+        limit->count++;
+        return true;
+    }
+
+    if(limit->suppressed < UINT16_MAX)
+    {
+        limit->suppressed++;
+    }
+
+    if(!limit->listed)
+    {
+        limit->listed = true;
+        limit->next = appLogLimitList;
+        appLogLimitList = limit;
+    }
+    return false;
+}
+
+/************************************************************************************************
+Function:  
+    void AppLogLimitTasks(void);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+void AppLogLimitTasks(void)
+{
+    uint32_t now = _CP0_GET_COUNT();
+    APP_LOG_LIMIT **link = &appLogLimitList;
+    APP_LOG_LIMIT *limit;
+
+    while(*link != NULL)
+    {
+        limit = *link;
+
+        if((limit->suppressed > ZERO) && ((now - limit->windowStart) < APP_LOG_RATE_WINDOW_TICKS))
+        {
+            /* Window still open */
+            link = &limit->next;
+            continue;
+        }
+
+        /* Sites the summary went out for ahead of their next message only leave the list */
+        if((limit->suppressed > ZERO) && !AppLogLimitReport(limit))
+        {
+            /* Lane full, the rest waits for the next call */
+            break;
+        }
+
+        limit->listed = false;
+        *link = limit->next;
+    }
+}
+#endif
+
+/************************************************************************************************
+Function:  
+    void AppLogLevelSet(uint8_t level);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+void AppLogLevelSet(uint8_t level)
+{
+    uint32_t levelBits = RESET;
+
+    if(level < APP_LOG_LEVEL_NONE)
+    {
+        /* This level and the ones above it */
+        levelBits = (0x7UL << level) & 0x7UL;
+    }
+    AppLogMaskSet(levelBits * 0x1111UL);
+}
+
+/************************************************************************************************
+Function:  
+    void AppLogMaskSet(uint32_t mask);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+void AppLogMaskSet(uint32_t mask)
+{
+    /* Only levels that exist in every module, 4 bits per module */
+    gAppLogMask = mask & (0x7UL * 0x1111UL);
+}
+
+/************************************************************************************************
+Function:  
+    uint32_t AppLogMaskGet(void);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+uint32_t AppLogMaskGet(void)
+{
+    return gAppLogMask;
+}
+
+#if (APP_LOG_PROFILE == true)
+/************************************************************************************************
+Function:  
+    void AppLogProfile(void);
+
+Remarks:  
+    See prototype in App_DebugPrint.h.
+ ************************************************************************************************/
+void AppLogProfile(void)
+{
+    uint32_t startCount;
+    uint32_t debugCycles;
+    uint32_t warningCycles;
+    uint32_t errorCycles;
+
+    /* The core timer runs at half the system clock */
+    startCount = _CP0_GET_COUNT();
+    LOGGING_DEBUG("profile %d", APP_LOG_LEVEL_DEBUG);
+    debugCycles = (_CP0_GET_COUNT() - startCount) * 2U;
+
+    startCount = _CP0_GET_COUNT();
+    LOGGING_WARNING("profile %d", APP_LOG_LEVEL_WARNING);
+    warningCycles = (_CP0_GET_COUNT() - startCount) * 2U;
+
+    startCount = _CP0_GET_COUNT();
+    LOGGING_ERROR("profile %d", APP_LOG_LEVEL_ERROR);
+    errorCycles = (_CP0_GET_COUNT() - startCount) * 2U;
+
+    AppDebugPrintf("   Log cycles (min %d): debug %lu, warning %lu, error %lu\r\n",
+            LOG_LEVEL_MIN, (unsigned long)debugCycles, (unsigned long)warningCycles, (unsigned long)errorCycles);
+}
+#endif
+
 /* *****************************************************************************
  End of File -:  App_DebugPrint.c
  */
\ No newline at end of file
@@ -0,0 +1,407 @@
+/* ************************************************************************** */
+/*
+  Company    : BTC POWER.
+
+  Author	 : Krushna C
+
+  Created    : 17 October 2026
+
+  File Name  : App_Format.c
+
+  Summary    : Integer-only formatter used in place of sprintf for debug output.
+
+  Description: This file contains `AppFormat` and `AppFormatV`. Decimal
+    conversion emits two digits per division using a digit pair table, and
+    hexadecimal conversion works a nibble at a time. Nothing is pulled in
+    from the C library formatter.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include "app.h"
+
+
+/* Section: File Scope Data                                                   */
+
+/* "00" to "99", two characters per entry */
+static const char formatDigitPairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const char formatHexLower[] = "0123456789abcdef";
+static const char formatHexUpper[] = "0123456789ABCDEF";
+
+/* Longest converted number: 10 decimal digits */
+#define APP_FORMAT_DIGITS_MAX     10U
+
+/* Most decimals printed by %f */
+#define APP_FORMAT_FLOAT_PRECISION_MAX  6U
+
+/* Output cursor shared by the conversion helpers */
+typedef struct
+{
+    char *buffer;
+    size_t size;
+    size_t length;
+} APP_FORMAT_OUT;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:
+    static void AppFormatPut(APP_FORMAT_OUT *out, char character, size_t count);
+
+Summary:
+    Appends `count` copies of `character`, keeping one byte for the NUL.
+ ************************************************************************************************/
+static void AppFormatPut(APP_FORMAT_OUT *out, char character, size_t count)
+{
+    while((count > 0U) && ((out->length + 1U) < out->size))
+    {
+        out->buffer[out->length++] = character;
+        count--;
+    }
+}
+
+/************************************************************************************************
+Function:
+    static void AppFormatField(APP_FORMAT_OUT *out, const char *text, size_t textLength,
+                               bool negative, size_t width, bool leftAlign, bool zeroPad);
+
+Summary:
+    Appends `text` padded to `width`, with an optional leading minus sign.
+ ************************************************************************************************/
+static void AppFormatField(APP_FORMAT_OUT *out, const char *text, size_t textLength,
+                           bool negative, size_t width, bool leftAlign, bool zeroPad)
+{
+    size_t fieldLength = textLength + (negative ? 1U : 0U);
+    size_t padding = (width > fieldLength) ? (width - fieldLength) : 0U;
+    size_t index;
+
+    if(!leftAlign && !zeroPad)
+    {
+        AppFormatPut(out, ' ', padding);
+    }
+    if(negative)
+    {
+        AppFormatPut(out, '-', 1U);
+    }
+    if(!leftAlign && zeroPad)
+    {
+        AppFormatPut(out, '0', padding);
+    }
+    for(index = ZERO; index < textLength; index++)
+    {
+        AppFormatPut(out, text[index], 1U);
+    }
+    if(leftAlign)
+    {
+        AppFormatPut(out, ' ', padding);
+    }
+}
+
+/************************************************************************************************
+Function:
+    static size_t AppFormatDecimal(char *end, uint32_t value);
+
+Summary:
+    Writes `value` in decimal so that it ends just before `end`.
+
+Returns:
+    Number of digits written.
+ ************************************************************************************************/
+static size_t AppFormatDecimal(char *end, uint32_t value)
+{
+    char *cursor = end;
+    uint32_t pair;
+
+    while(value >= 100U)
+    {
+        pair = (value % 100U) * 2U;
+        value /= 100U;
+        *--cursor = formatDigitPairs[pair + 1U];
+        *--cursor = formatDigitPairs[pair];
+    }
+    if(value >= 10U)
+    {
+        pair = value * 2U;
+        *--cursor = formatDigitPairs[pair + 1U];
+        *--cursor = formatDigitPairs[pair];
+    }
+    else
+    {
+        *--cursor = (char)('0' + value);
+    }
+    return (size_t)(end - cursor);
+}
+
+/************************************************************************************************
+Function:
+    static size_t AppFormatHex(char *end, uint32_t value, const char *digits);
+
+Summary:
+    Writes `value` in hexadecimal so that it ends just before `end`.
+
+Returns:
+    Number of digits written.
+ ************************************************************************************************/
+static size_t AppFormatHex(char *end, uint32_t value, const char *digits)
+{
+    char *cursor = end;
+
+    do
+    {
+        *--cursor = digits[value & 0xFU];
+        value >>= 4;
+    } while(value != 0U);
+
+    return (size_t)(end - cursor);
+}
+
+#if (APP_FORMAT_FLOAT_SUPPORT == true)
+/************************************************************************************************
+Function:
+    static void AppFormatFloat(APP_FORMAT_OUT *out, double value, size_t precision,
+                               size_t width, bool leftAlign, bool zeroPad);
+
+Summary:
+    Appends `value` in fixed point notation, rounded to `precision` decimals.
+
+Remarks:
+    Only for values whose integer part fits in 32 bits; larger values are clamped.
+ ************************************************************************************************/
+static void AppFormatFloat(APP_FORMAT_OUT *out, double value, size_t precision,
+                           size_t width, bool leftAlign, bool zeroPad)
+{
+    char digits[APP_FORMAT_DIGITS_MAX + 1U + APP_FORMAT_FLOAT_PRECISION_MAX];
+    char *end = &digits[APP_FORMAT_DIGITS_MAX];
+    bool negative = (value < 0.0);
+    double scale = 1.0;
+    uint32_t integerPart;
+    uint32_t fraction;
+    size_t length;
+    size_t index;
+
+    if(precision > APP_FORMAT_FLOAT_PRECISION_MAX)
+    {
+        precision = APP_FORMAT_FLOAT_PRECISION_MAX;
+    }
+    if(negative)
+    {
+        value = -value;
+    }
+    for(index = ZERO; index < precision; index++)
+    {
+        scale *= 10.0;
+    }
+
+    value += 0.5 / scale;
+    integerPart = (value >= 4294967295.0) ? 0xFFFFFFFFU : (uint32_t)value;
+    fraction = (uint32_t)((value - (double)integerPart) * scale);
+
+    length = AppFormatDecimal(end, integerPart);
+    if(precision > 0U)
+    {
+        end[0] = '.';
+        for(index = precision; index > 0U; index--)
+        {
+            end[index] = (char)('0' + (fraction % 10U));
+            fraction /= 10U;
+        }
+    }
+    AppFormatField(out, end - length, length + ((precision > 0U) ? (precision + 1U) : 0U),
+                   negative, width, leftAlign, zeroPad);
+}
+#endif
+
+
+/* Section: Interface Functions                                               */
+
+/************************************************************************************************
+Function:
+    int AppFormatV(char *buffer, size_t size, const char *format, va_list args);
+
+Remarks:
+    See prototype in App_Format.h.
+ ************************************************************************************************/
+int AppFormatV(char *buffer, size_t size, const char *format, va_list args)
+{
+    APP_FORMAT_OUT out = {buffer, size, 0U};
+    char digits[APP_FORMAT_DIGITS_MAX];
+    char *digitsEnd = &digits[APP_FORMAT_DIGITS_MAX];
+    const char *text;
+    size_t textLength;
+    size_t width;
+    size_t precision;
+    bool hasPrecision;
+    bool leftAlign;
+    bool zeroPad;
+    int32_t signedValue;
+    uint32_t value;
+
+    if((buffer == NULL) || (size == 0U) || (format == NULL))
+    {
+        return 0;
+    }
+
+    while(*format != '\0')
+    {
+        if(*format != '%')
+        {
+            AppFormatPut(&out, *format++, 1U);
+            continue;
+        }
+        format++;
+
+        /* Flags */
+        leftAlign = false;
+        zeroPad = false;
+        while((*format == '-') || (*format == '0'))
+        {
+            if(*format == '-')
+            {
+                leftAlign = true;
+            }
+            else
+            {
+                zeroPad = true;
+            }
+            format++;
+        }
+
+        /* Width and precision */
+        width = 0U;
+        while((*format >= '0') && (*format <= '9'))
+        {
+            width = (width * 10U) + (size_t)(*format++ - '0');
+        }
+        precision = 0U;
+        hasPrecision = (*format == '.');
+        if(hasPrecision)
+        {
+            format++;
+            while((*format >= '0') && (*format <= '9'))
+            {
+                precision = (precision * 10U) + (size_t)(*format++ - '0');
+            }
+        }
+
+        /* int and long are both 32 bits on this target */
+        while((*format == 'l') || (*format == 'h'))
+        {
+            format++;
+        }
+
+        switch(*format)
+        {
+            case 'd':
+            case 'i':
+                signedValue = va_arg(args, int32_t);
+                value = (signedValue < 0) ? (0U - (uint32_t)signedValue) : (uint32_t)signedValue;
+                textLength = AppFormatDecimal(digitsEnd, value);
+                AppFormatField(&out, digitsEnd - textLength, textLength, (signedValue < 0), width, leftAlign, zeroPad);
+                break;
+
+            case 'u':
+                textLength = AppFormatDecimal(digitsEnd, va_arg(args, uint32_t));
+                AppFormatField(&out, digitsEnd - textLength, textLength, false, width, leftAlign, zeroPad);
+                break;
+
+            case 'x':
+                textLength = AppFormatHex(digitsEnd, va_arg(args, uint32_t), formatHexLower);
+                AppFormatField(&out, digitsEnd - textLength, textLength, false, width, leftAlign, zeroPad);
+                break;
+
+            case 'X':
+                textLength = AppFormatHex(digitsEnd, va_arg(args, uint32_t), formatHexUpper);
+                AppFormatField(&out, digitsEnd - textLength, textLength, false, width, leftAlign, zeroPad);
+                break;
+
+            case 'p':
+                /* Always the full 8 digits of a 32-bit address */
+                AppFormatPut(&out, '0', 1U);
+                AppFormatPut(&out, 'x', 1U);
+                textLength = AppFormatHex(digitsEnd, (uint32_t)(uintptr_t)va_arg(args, void *), formatHexLower);
+                AppFormatField(&out, digitsEnd - textLength, textLength, false, 8U, false, true);
+                break;
+
+            case 'c':
+                digits[0] = (char)va_arg(args, int);
+                AppFormatField(&out, digits, 1U, false, width, leftAlign, false);
+                break;
+
+            case 's':
+                text = va_arg(args, const char *);
+                if(text == NULL)
+                {
+                    text = "(null)";
+                }
+                for(textLength = ZERO; (text[textLength] != '\0') && (!hasPrecision || (textLength < precision)); textLength++)
+                {
+                }
+                AppFormatField(&out, text, textLength, false, width, leftAlign, false);
+                break;
+
+#if (APP_FORMAT_FLOAT_SUPPORT == true)
+            case 'f':
+                AppFormatFloat(&out, va_arg(args, double), hasPrecision ? precision : 6U, width, leftAlign, zeroPad);
+                break;
+#endif
+
+            case '%':
+                AppFormatPut(&out, '%', 1U);
+                break;
+
+            case '\0':
+                /* Format ends inside a conversion */
+                format--;
+                break;
+
+            default:
+                /* Unsupported conversion, copied through so it shows in the output */
+                AppFormatPut(&out, '%', 1U);
+                AppFormatPut(&out, *format, 1U);
+                break;
+        }
+        format++;
+    }
+
+    buffer[out.length] = '\0';
+    return (int)out.length;
+}
+
+/************************************************************************************************
+Function:
+    int AppFormat(char *buffer, size_t size, const char *format, ...);
+
+Remarks:
+    See prototype in App_Format.h.
+ ************************************************************************************************/
+int AppFormat(char *buffer, size_t size, const char *format, ...)
+{
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = AppFormatV(buffer, size, format, args);
+    va_end(args);
+
+    return length;
+}
+
+/* *****************************************************************************
+ End of File -:  App_Format.c
+ */
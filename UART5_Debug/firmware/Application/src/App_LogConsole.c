@@ -0,0 +1,306 @@
+/* ************************************************************************** */
+/*
+  Company    : BTC POWER.
+
+  Author	 : Krushna C
+
+  Created    : 17 October 2026
+
+  File Name  : App_LogConsole.c
+
+  Summary    : UART5 command console for the runtime log mask.
+
+  Description: This file contains `AppLogConsoleTasks`, which polls the UART5
+    receiver through `DRV_USART0_Read`, assembles command lines and applies
+    LOGMASK and LOGLEVEL commands to the log mask used by the LOGGING_* macros.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "app.h"
+
+
+/* Section: File Scope Data                                                   */
+
+/* Command line being received */
+static char consoleLine[APP_LOG_CONSOLE_LINE_MAX + 1U];
+
+/* Number of characters in consoleLine, APP_LOG_CONSOLE_LINE_MAX + 1 after an overlong line */
+static uint8_t consoleLength = RESET;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:
+    static bool AppLogConsoleParse(const char *text, int base, uint32_t *value);
+
+Summary:
+    Converts the whole of `text` to a number.
+
+Returns:
+    true when `text` is a non-empty number with no trailing characters.
+ ************************************************************************************************/
+static bool AppLogConsoleParse(const char *text, int base, uint32_t *value)
+{
+    char *end = NULL;
+
+    if(*text == '\0')
+    {
+        return false;
+    }
+    *value = (uint32_t)strtoul(text, &end, base);
+    return (*end == '\0');
+}
+
+#if (DRV_USART_STATISTICS == true)
+/************************************************************************************************
+Function:
+    static void AppLogConsoleStatsReport(void);
+
+Summary:
+    Queues the USART5 driver counters as "USARTSTAT key=value ..." lines.
+
+Remarks:
+    Every line starts with USARTSTAT and holds space separated decimal key=value pairs, so a
+    host script can pick the lines out of a capture and subtract two snapshots.
+ ************************************************************************************************/
+static void AppLogConsoleStatsReport(void)
+{
+    DRV_USART_STATS stats;
+
+    DRV_USART0_StatsGet(&stats);
+
+    AppDebugPrintf("\r\nUSARTSTAT tx=%lu rx=%lu txfull=%lu\r\n",
+                   (unsigned long)stats.txBytes, (unsigned long)stats.rxBytes, (unsigned long)stats.txFifoFull);
+
+    AppDebugPrintf("USARTSTAT oerr=%lu ferr=%lu perr=%lu flushed=%lu\r\n",
+                   (unsigned long)stats.overrunErrors, (unsigned long)stats.framingErrors,
+                   (unsigned long)stats.parityErrors, (unsigned long)stats.flushedBytes);
+
+    AppDebugPrintf("USARTSTAT isrtx=%lu isrrx=%lu isrerr=%lu\r\n",
+                   (unsigned long)stats.txInterrupts, (unsigned long)stats.rxInterrupts,
+                   (unsigned long)stats.errorInterrupts);
+
+    AppDebugPrintf("USARTSTAT wqhw=%lu rqhw=%lu rxhw=%lu rxdrop=%lu\r\n",
+                   (unsigned long)stats.writeQueueHighWater, (unsigned long)stats.readQueueHighWater,
+                   (unsigned long)stats.rxRingHighWater, (unsigned long)stats.rxRingDropBytes);
+
+    AppDebugPrintf("USARTSTAT ctsstall=%lu ctsus=%lu rtsoff=%lu\r\n",
+                   (unsigned long)stats.ctsStalls, (unsigned long)(stats.ctsStallTicks / (CORE_TIMER_HZ / 1000000U)),
+                   (unsigned long)stats.rtsDeasserts);
+}
+#endif
+
+#if (DRV_USART_INTERRUPT_MODE == true) && (DRV_USART_ISR_PROFILE == true)
+/************************************************************************************************
+Function:
+    static void AppLogConsoleIsrReport(void);
+
+Summary:
+    Queues the UART5 ISR measurements, converted from core timer ticks to system clock cycles.
+
+Remarks:
+    LAT runs from enabling the transmit source to the first ISR statement and covers the
+    interrupt latency plus the prologue, which is where the shadow register set saves time.
+    BODY is the time spent in the driver tasks. SRS shows whether DRV_USART_INT_SRS_IDX0 is set.
+ ************************************************************************************************/
+static void AppLogConsoleIsrReport(void)
+{
+    DRV_USART_ISR_PROFILE_DATA profile;
+
+    DRV_USART0_IsrProfileGet(&profile);
+    if(profile.latencyCount == ZERO)
+    {
+        profile.latencyMin = ZERO;
+    }
+    if(profile.count == ZERO)
+    {
+        profile.bodyMin = ZERO;
+    }
+
+    AppDebugPrintf("\r\nISRSTAT SRS=%u N=%lu LAT=%lu..%lu BODY=%lu..%lu cycles\r\n",
+                   (unsigned)DRV_USART_INT_SRS_IDX0, (unsigned long)profile.count,
+                   (unsigned long)(profile.latencyMin * 2U), (unsigned long)(profile.latencyMax * 2U),
+                   (unsigned long)(profile.bodyMin * 2U), (unsigned long)(profile.bodyMax * 2U));
+}
+#endif
+
+/************************************************************************************************
+Function:
+    static void AppLogConsoleBaudReport(void);
+
+Summary:
+    Queues the UART5 baud rate setting and its error as
+    "BAUD set=<rate> actual=<rate> err=<+/-x.xx>% brgh=<0|1> brg=<n>".
+ ************************************************************************************************/
+static void AppLogConsoleBaudReport(void)
+{
+    DRV_USART_BAUD_STATUS baud;
+    uint32_t error;
+
+    DRV_USART0_BaudStatusGet(&baud);
+    error = (baud.errorHundredths < ZERO) ? (uint32_t)(-baud.errorHundredths) : (uint32_t)baud.errorHundredths;
+
+    AppDebugPrintf("\r\nBAUD set=%lu actual=%lu err=%c%lu.%02lu%% brgh=%u brg=%u\r\n",
+                   (unsigned long)baud.requested, (unsigned long)baud.actual,
+                   (baud.errorHundredths < ZERO) ? '-' : '+', (unsigned long)(error / 100U),
+                   (unsigned long)(error % 100U), (unsigned)baud.brgh, (unsigned)baud.brg);
+}
+
+/************************************************************************************************
+Function:
+    static void AppLogConsoleExecute(void);
+
+Summary:
+    Runs the command held in consoleLine and queues the reply.
+ ************************************************************************************************/
+static void AppLogConsoleExecute(void)
+{
+    uint32_t value = RESET;
+
+#if (APP_BAUD_LINK == true)
+    /* Rate negotiation, and every line while a new rate is on trial */
+    if(AppBaudLinkCommand(consoleLine))
+    {
+        return;
+    }
+#endif
+
+#if (DRV_USART_STATISTICS == true)
+    if(strcmp(consoleLine, "USARTSTAT?") == 0)
+    {
+        AppLogConsoleStatsReport();
+        return;
+    }
+#endif
+
+#if (DRV_USART_INTERRUPT_MODE == true) && (DRV_USART_ISR_PROFILE == true)
+    if(strcmp(consoleLine, "ISRSTAT?") == 0)
+    {
+        AppLogConsoleIsrReport();
+        return;
+    }
+#endif
+
+    if(strcmp(consoleLine, "BAUD?") == 0)
+    {
+        AppLogConsoleBaudReport();
+        return;
+    }
+
+    if(strcmp(consoleLine, "LOGMASK?") == 0)
+    {
+        /* Query only, fall through to the report */
+    }
+    else if((strncmp(consoleLine, "LOGMASK=", 8) == 0) && AppLogConsoleParse(&consoleLine[8], 16, &value))
+    {
+        AppLogMaskSet(value);
+    }
+    else if((strncmp(consoleLine, "LOGLEVEL=", 9) == 0) && AppLogConsoleParse(&consoleLine[9], 10, &value) &&
+            (value <= APP_LOG_LEVEL_NONE))
+    {
+        AppLogLevelSet((uint8_t)value);
+    }
+    else
+    {
+        AppDebugPrint("\r\nLOGMASK ERR\r\n");
+        return;
+    }
+
+    AppDebugPrintf("\r\nLOGMASK=%08lX\r\n", (unsigned long)AppLogMaskGet());
+}
+
+
+/************************************************************************************************
+Function:
+    static void AppLogConsoleFeed(const uint8_t *rxData, size_t rxCount);
+
+Summary:
+    Adds received characters to consoleLine and runs every completed command.
+ ************************************************************************************************/
+static void AppLogConsoleFeed(const uint8_t *rxData, size_t rxCount)
+{
+    size_t index;
+
+    for(index = ZERO; index < rxCount; index++)
+    {
+        if((rxData[index] == '\r') || (rxData[index] == '\n'))
+        {
+            if((consoleLength > ZERO) && (consoleLength <= APP_LOG_CONSOLE_LINE_MAX))
+            {
+                consoleLine[consoleLength] = '\0';
+                AppLogConsoleExecute();
+            }
+            consoleLength = RESET;
+        }
+        else if(consoleLength < APP_LOG_CONSOLE_LINE_MAX)
+        {
+            consoleLine[consoleLength++] = (char)rxData[index];
+        }
+        else
+        {
+            /* Overlong line, ignored up to its end */
+            consoleLength = APP_LOG_CONSOLE_LINE_MAX + 1U;
+        }
+    }
+}
+
+
+/* Section: Interface Functions                                               */
+
+/************************************************************************************************
+Function:
+    void AppLogConsoleTasks(void);
+
+Remarks:
+    See prototype in App_LogConsole.h.
+ ************************************************************************************************/
+void AppLogConsoleTasks(void)
+{
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    const uint8_t *rxData;
+    size_t rxCount;
+
+    if(DRV_USART0_ErrorGet() != DRV_USART_ERROR_NONE)
+    {
+        /* The driver cleared the error, drop the partial line */
+        consoleLength = RESET;
+#if (APP_BAUD_LINK == true)
+        AppBaudLinkRxError();
+#endif
+    }
+
+    /* Parse the receive ring in place, at most two parts across the wrap */
+    while((rxCount = DRV_USART0_RxRingPeek(&rxData)) != ZERO)
+    {
+        AppLogConsoleFeed(rxData, rxCount);
+        DRV_USART0_RxRingConsume(rxCount);
+    }
+#else
+    uint8_t rxData[APP_LOG_CONSOLE_RX_CHUNK];
+    size_t rxCount;
+
+    rxCount = DRV_USART0_Read(rxData, sizeof(rxData));
+    if(rxCount == DRV_USART_READ_ERROR)
+    {
+        /* The driver cleared the error, drop the partial line */
+        consoleLength = RESET;
+#if (APP_BAUD_LINK == true)
+        AppBaudLinkRxError();
+#endif
+        return;
+    }
+
+    AppLogConsoleFeed(rxData, rxCount);
+#endif
+}
+
+/* *****************************************************************************
+ End of File -:  App_LogConsole.c
+ */
@@ -0,0 +1,353 @@
+/* ************************************************************************** */
+/*
+  Company    : BTC POWER.
+
+  Author	 : Krushna C
+
+  Created    : 17 October 2026
+
+  File Name  : App_LogPersist.c
+
+  Summary    : Crash persistent copy of the most recent log records.
+
+  Description: This file keeps the last APP_LOG_PERSIST_SIZE bytes of log
+    output in a ring placed in the `persistent` section, which the XC32
+    startup code does not clear. The ring header holds a magic number and a
+    checksum over the header and the data, kept up to date as bytes are
+    overwritten. A reset that happens while a record is being stored leaves a
+    mismatching checksum, and the ring is then discarded rather than replayed.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+#include "app.h"
+
+#if (APP_LOG_PERSIST == true)
+
+#if ((APP_LOG_PERSIST_SIZE & (APP_LOG_PERSIST_SIZE - 1U)) != 0U)
+#error "APP_LOG_PERSIST_SIZE must be a power of two"
+#endif
+
+
+/* Section: Data Types                                                        */
+
+/* Ring kept across resets */
+typedef struct
+{
+    /* APP_LOG_PERSIST_MAGIC when the ring has been initialized */
+    uint32_t magic;
+
+    /* Free running write index */
+    uint32_t head;
+
+    /* Valid bytes in the ring, at most APP_LOG_PERSIST_SIZE */
+    uint32_t used;
+
+    /* magic + head + used + sum of all data bytes */
+    uint32_t checksum;
+
+    /* Records, each behind its length in APP_LOG_PERSIST_HEADER bytes */
+    uint8_t buffer[APP_LOG_PERSIST_SIZE];
+
+} APP_LOG_PERSIST_RING;
+
+/* Replay progress */
+typedef enum
+{
+    APP_LOG_PERSIST_IDLE = 0,
+    APP_LOG_PERSIST_REPLAY_START,
+    APP_LOG_PERSIST_REPLAY_DATA,
+    APP_LOG_PERSIST_REPLAY_END
+} APP_LOG_PERSIST_STATE;
+
+
+/* Section: File Scope Data                                                   */
+
+/* Not initialized by the startup code, survives any reset without power loss */
+static APP_LOG_PERSIST_RING persistRing __attribute__((persistent));
+
+static APP_LOG_PERSIST_STATE persistState = APP_LOG_PERSIST_IDLE;
+
+/* Next byte to replay and bytes left */
+static uint32_t persistReplayIndex = RESET;
+static uint32_t persistReplayLeft = RESET;
+
+/* Little endian length in front of every record */
+#define APP_LOG_PERSIST_HEADER          2U
+
+/* Reset cause flags of RCON. The hardware only sets them, so each one left
+   standing would be reported again after every later reset. */
+#define APP_LOG_PERSIST_RCON_CAUSES     (_RCON_POR_MASK | _RCON_BOR_MASK | _RCON_IDLE_MASK | \
+                                         _RCON_SLEEP_MASK | _RCON_WDTO_MASK | _RCON_SWR_MASK | \
+                                         _RCON_EXTR_MASK | _RCON_CMR_MASK)
+
+/* Reset cause captured at start up */
+static uint32_t persistResetCause = RESET;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:
+    static uint32_t AppLogPersistChecksum(void);
+
+Summary:
+    Computes the ring checksum from scratch.
+ ************************************************************************************************/
+static uint32_t AppLogPersistChecksum(void)
+{
+    uint32_t sum = persistRing.magic + persistRing.head + persistRing.used;
+    uint32_t index;
+
+    for(index = ZERO; index < APP_LOG_PERSIST_SIZE; index++)
+    {
+        sum += persistRing.buffer[index];
+    }
+    return sum;
+}
+
+/************************************************************************************************
+Function:
+    static uint32_t AppLogPersistLengthGet(uint32_t index);
+
+Summary:
+    Reads the length of the record whose header starts at free running index `index`.
+ ************************************************************************************************/
+static uint32_t AppLogPersistLengthGet(uint32_t index)
+{
+    return (uint32_t)persistRing.buffer[index & (APP_LOG_PERSIST_SIZE - 1U)] |
+           ((uint32_t)persistRing.buffer[(index + 1U) & (APP_LOG_PERSIST_SIZE - 1U)] << 8);
+}
+
+/************************************************************************************************
+Function:
+    static uint32_t AppLogPersistPut(uint32_t index, uint8_t value, uint32_t checksum);
+
+Summary:
+    Stores one byte at free running index `index` and returns `checksum` updated for it.
+ ************************************************************************************************/
+static uint32_t AppLogPersistPut(uint32_t index, uint8_t value, uint32_t checksum)
+{
+    uint8_t *slot = &persistRing.buffer[index & (APP_LOG_PERSIST_SIZE - 1U)];
+
+    checksum += (uint32_t)value - *slot;
+    *slot = value;
+    return checksum;
+}
+
+/************************************************************************************************
+Function:
+    static void AppLogPersistClear(void);
+
+Summary:
+    Empties the ring and makes it valid.
+ ************************************************************************************************/
+static void AppLogPersistClear(void)
+{
+    persistRing.magic = APP_LOG_PERSIST_MAGIC;
+    persistRing.head = RESET;
+    persistRing.used = RESET;
+    persistRing.checksum = AppLogPersistChecksum();
+}
+
+
+/* Section: Interface Functions                                               */
+
+/************************************************************************************************
+Function:
+    void AppLogPersistInitialize(void);
+
+Remarks:
+    See prototype in App_LogPersist.h.
+ ************************************************************************************************/
+void AppLogPersistInitialize(void)
+{
+    persistResetCause = RCON;
+    RCONCLR = APP_LOG_PERSIST_RCON_CAUSES;
+
+    if((persistRing.magic == APP_LOG_PERSIST_MAGIC) && (persistRing.used > ZERO) &&
+       (persistRing.used <= APP_LOG_PERSIST_SIZE) && (persistRing.checksum == AppLogPersistChecksum()))
+    {
+        persistReplayIndex = persistRing.head - persistRing.used;
+        persistReplayLeft = persistRing.used;
+        persistState = APP_LOG_PERSIST_REPLAY_START;
+    }
+    else
+    {
+        AppLogPersistClear();
+        persistState = APP_LOG_PERSIST_IDLE;
+    }
+}
+
+/************************************************************************************************
+Function:
+    void AppLogPersistWrite(const char *record, size_t length);
+
+Remarks:
+    See prototype in App_LogPersist.h.
+ ************************************************************************************************/
+void AppLogPersistWrite(const char *record, size_t length)
+{
+    uint32_t checksum;
+    uint32_t head;
+    uint32_t used;
+    uint32_t dropped;
+    uint32_t index;
+
+    /* Keep the old session intact until it has been replayed */
+    if((record == NULL) || (length == ZERO) || (persistState != APP_LOG_PERSIST_IDLE))
+    {
+        return;
+    }
+
+    if(length > APP_LOG_PERSIST_RECORD_MAX)
+    {
+        length = APP_LOG_PERSIST_RECORD_MAX;
+    }
+
+    checksum = persistRing.checksum - persistRing.head - persistRing.used;
+    head = persistRing.head;
+    used = persistRing.used;
+
+    /* Make room by dropping the oldest records whole, the replay only sees complete ones */
+    while((used + APP_LOG_PERSIST_HEADER + length) > APP_LOG_PERSIST_SIZE)
+    {
+        dropped = APP_LOG_PERSIST_HEADER + AppLogPersistLengthGet(head - used);
+        used = (dropped < used) ? (used - dropped) : RESET;
+    }
+
+    checksum = AppLogPersistPut(head, (uint8_t)length, checksum);
+    checksum = AppLogPersistPut(head + 1U, (uint8_t)(length >> 8), checksum);
+    for(index = ZERO; index < length; index++)
+    {
+        checksum = AppLogPersistPut(head + APP_LOG_PERSIST_HEADER + index, (uint8_t)record[index], checksum);
+    }
+
+    head += APP_LOG_PERSIST_HEADER + (uint32_t)length;
+    used += APP_LOG_PERSIST_HEADER + (uint32_t)length;
+
+    persistRing.head = head;
+    persistRing.used = used;
+    persistRing.checksum = checksum + head + used;
+}
+
+/************************************************************************************************
+Function:
+    bool AppLogPersistReplayPending(void);
+
+Remarks:
+    See prototype in App_LogPersist.h.
+ ************************************************************************************************/
+bool AppLogPersistReplayPending(void)
+{
+    return (persistState != APP_LOG_PERSIST_IDLE);
+}
+
+/************************************************************************************************
+Function:
+    bool AppLogPersistReplayTasks(void);
+
+Remarks:
+    See prototype in App_LogPersist.h.
+ ************************************************************************************************/
+bool AppLogPersistReplayTasks(void)
+{
+    char line[APP_LOG_PERSIST_LINE_MAX];
+    char *record;
+    uint32_t recordLength;
+    uint32_t index;
+    int length;
+
+    switch(persistState)
+    {
+        case APP_LOG_PERSIST_REPLAY_START:
+        {
+            length = AppFormat(line, sizeof(line), "\r\n====[ LOG BEFORE RESET, RCON 0x%08lX ]====\r\n",
+                               (unsigned long)persistResetCause);
+            if(UartWriteQueuedHigh(line, length) == SUCCESS)
+            {
+                persistState = APP_LOG_PERSIST_REPLAY_DATA;
+            }
+            break;
+        }
+
+        case APP_LOG_PERSIST_REPLAY_DATA:
+        {
+            recordLength = AppLogPersistLengthGet(persistReplayIndex);
+            if((recordLength == ZERO) || (recordLength > APP_LOG_PERSIST_RECORD_MAX) ||
+               ((APP_LOG_PERSIST_HEADER + recordLength) > persistReplayLeft))
+            {
+                /* Not a record the writer could have left, end the replay here */
+                persistState = APP_LOG_PERSIST_REPLAY_END;
+                break;
+            }
+
+            /* The lane is small, a record it cannot take now is retried on the next pass */
+            record = UartTxReserveHigh((int)recordLength);
+            if(record != NULL)
+            {
+                for(index = ZERO; index < recordLength; index++)
+                {
+                    record[index] = (char)persistRing.buffer[(persistReplayIndex + APP_LOG_PERSIST_HEADER + index) &
+                                                             (APP_LOG_PERSIST_SIZE - 1U)];
+                }
+                (void)UartTxCommit((int)recordLength);
+
+                persistReplayIndex += APP_LOG_PERSIST_HEADER + recordLength;
+                persistReplayLeft -= APP_LOG_PERSIST_HEADER + recordLength;
+                if(persistReplayLeft == ZERO)
+                {
+                    persistState = APP_LOG_PERSIST_REPLAY_END;
+                }
+            }
+            break;
+        }
+
+        case APP_LOG_PERSIST_REPLAY_END:
+        {
+            length = AppFormat(line, sizeof(line), "\r\n====[ END OF LOG BEFORE RESET ]====\r\n");
+            if(UartWriteQueuedHigh(line, length) == SUCCESS)
+            {
+                /* Start recording the new session */
+                AppLogPersistClear();
+                persistState = APP_LOG_PERSIST_IDLE;
+            }
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return (persistState == APP_LOG_PERSIST_IDLE);
+}
+
+/************************************************************************************************
+Function:
+    void AppLogPersistException(uint32_t cause, uint32_t address);
+
+Remarks:
+    See prototype in App_LogPersist.h.
+ ************************************************************************************************/
+void AppLogPersistException(uint32_t cause, uint32_t address)
+{
+    /* Static, the stack may not be usable after an exception */
+    static char exceptionRecord[APP_LOG_PERSIST_LINE_MAX];
+    int length;
+
+    length = AppFormat(exceptionRecord, sizeof(exceptionRecord), "\r\nGeneral Exception cause=%lu addr=0x%08lX\r\n",
+                       (unsigned long)cause, (unsigned long)address);
+    AppLogPersistWrite(exceptionRecord, (size_t)length);
+}
+
+#endif /* APP_LOG_PERSIST */
+
+/* *****************************************************************************
+ End of File -:  App_LogPersist.c
+ */
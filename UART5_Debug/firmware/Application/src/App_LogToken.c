@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*
+  Company    : BTC POWER.
+
+  Author	 : Krushna C
+
+  Created    : 17 October 2026
+
+  File Name  : App_LogToken.c
+
+  Summary    : Encoder for tokenized (deferred format) log records.
+
+  Description: This file contains `AppLogTokenWrite`, which packs a call site id,
+    the core timer ticks since the previous record and the raw call arguments
+    into a compact varint
+    record built in place in the UART transmit ring. No formatting happens on the
+    target; the host tool LogDecoder expands the records using the format
+    strings stored in the `.app_log_sites` section of the ELF file.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdarg.h>
+#include "app.h"
+
+#if ((2U + 5U + 10U + (5U * APP_LOG_TOKEN_ARGS_MAX)) > APP_LOG_TOKEN_RECORD_MAX)
+#error "APP_LOG_TOKEN_RECORD_MAX is too small for APP_LOG_TOKEN_ARGS_MAX arguments"
+#endif
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+Function:
+    static uint8_t AppLogTokenVarint(uint8_t *record, uint8_t index, uint64_t value);
+
+Summary:
+    Appends `value` to `record` as an unsigned LEB128 varint.
+
+Returns:
+    The index following the last byte written.
+ ************************************************************************************************/
+static uint8_t AppLogTokenVarint(uint8_t *record, uint8_t index, uint64_t value)
+{
+    while(value >= 0x80U)
+    {
+        record[index++] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+    }
+    record[index++] = (uint8_t)value;
+    return index;
+}
+
+
+/* Section: Interface Functions                                               */
+
+/************************************************************************************************
+Function:
+    int8_t AppLogTokenWrite(uint8_t level, uint32_t siteId, uint8_t argCount, ...);
+
+Remarks:
+    See prototype in App_LogToken.h.
+ ************************************************************************************************/
+int8_t AppLogTokenWrite(uint8_t level, uint32_t siteId, uint8_t argCount, ...)
+{
+    uint8_t *record;
+    uint8_t index = 2U; /* Sync and length bytes are filled in last */
+    uint8_t argIndex;
+    int recordMax;
+    va_list args;
+
+    if(argCount > APP_LOG_TOKEN_ARGS_MAX)
+    {
+        return e_ERROR_BUFFER_SIZE_INVALID;
+    }
+
+    /* A 32-bit varint takes up to 5 bytes, the 64-bit delta up to 10 */
+    recordMax = (int)(2U + 5U + 10U + (5U * argCount));
+
+    /* Errors overtake any debug traffic already queued */
+    record = (uint8_t *)((level == APP_LOG_LEVEL_ERROR) ? UartTxReserveHigh(recordMax) : UartTxReserve(recordMax));
+    if(record == NULL)
+    {
+        /* Counted as a dropped record by the driver. The interval is not
+           restarted, so the next record's delta still covers this one. */
+        return e_ERROR_UART_TX_RING_FULL;
+    }
+
+    index = AppLogTokenVarint(record, index, siteId);
+    index = AppLogTokenVarint(record, index, AppLogStampDelta());
+
+    /* Every integer, character and pointer argument is passed as a 32-bit word */
+    va_start(args, argCount);
+    for(argIndex = ZERO; argIndex < argCount; argIndex++)
+    {
+        index = AppLogTokenVarint(record, index, va_arg(args, uint32_t));
+    }
+    va_end(args);
+
+    record[0] = APP_LOG_TOKEN_SYNC;
+    record[1] = index - 2U;
+
+#if (APP_LOG_PERSIST == true)
+    AppLogPersistWrite((char *)record, index);
+#endif
+
+    return UartTxCommit((int)index);
+}
+
+/* *****************************************************************************
+ End of File -:  App_LogToken.c
+ */
@@ -0,0 +1,116 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : HAL_CoreTimer.h
+
+  Summary     : 64-bit time base built on the MIPS CP0 Count register.
+
+  Description : The CP0 Count register counts at half the system clock and
+				wraps every 2^32 ticks (about 107 s at 80 MHz). `CoreTimerGet64`
+				extends it to 64 bits in software, so time stamps taken with it
+				never wrap during the life of the product. On top of it the HAL
+				shares wall clock timeouts in microseconds, which do not depend
+				on the compiler optimization level or the cache setup, and
+				`CoreTimerYield`, which idles the CPU inside a blocking wait.
+ ************************************************************************* */
+
+#ifndef HAL_CORETIMER_H
+#define HAL_CORETIMER_H
+
+/* Core timer tick rate, the Count register increments every second system clock */
+#define CORE_TIMER_HZ               (SYS_CLK_FREQ / 2UL)
+
+/* Core timer ticks per microsecond */
+#define CORE_TIMER_TICKS_PER_US     (CORE_TIMER_HZ / 1000000UL)
+
+/* Deadline of a timeout started with CoreTimerTimeoutStart */
+typedef struct
+{
+    uint64_t deadline;
+} CORE_TIMER_TIMEOUT;
+
+/************************************************************************************************
+ * Function    : uint64_t CoreTimerGet64(void)
+ * 
+ * Summary     : Returns the CP0 Count register extended to 64 bits.
+ * 
+ * Description : The upper 32 bits are counted in software by detecting when the Count
+ *               register is lower than at the previous call. The read is done with
+ *               interrupts disabled so that an interrupt handler calling this function
+ *               cannot count the same wrap twice.
+ * 
+ * Returns     : Core timer ticks since reset.
+ * 
+ * Remarks     : Must be called at least once per Count register period (about 107 s),
+ *               otherwise a wrap is missed. The log path calls it for every record.
+ ************************************************************************************************/
+uint64_t CoreTimerGet64(void);
+
+/************************************************************************************************
+ * Function    : uint64_t CoreTimerDeltaGet(uint64_t *reference)
+ * 
+ * Summary     : Returns the ticks elapsed since `*reference` and moves it to now.
+ * 
+ * Parameters  :
+ *              reference  - Time stamp of the previous event, updated to the current time.
+ * 
+ * Returns     : Ticks between the previous time stamp and now.
+ ************************************************************************************************/
+uint64_t CoreTimerDeltaGet(uint64_t *reference);
+
+/************************************************************************************************
+ * Function    : void CoreTimerTimeoutStart(CORE_TIMER_TIMEOUT *timeout, uint32_t microseconds)
+ * 
+ * Summary     : Starts a timeout that expires `microseconds` from now.
+ * 
+ * Parameters  :
+ *              timeout       - Timeout to start.
+ *              microseconds  - Duration, up to about 71 minutes.
+ ************************************************************************************************/
+void CoreTimerTimeoutStart(CORE_TIMER_TIMEOUT *timeout, uint32_t microseconds);
+
+/************************************************************************************************
+ * Function    : bool CoreTimerTimeoutExpired(const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Summary     : Returns true once the duration given to CoreTimerTimeoutStart has passed.
+ ************************************************************************************************/
+bool CoreTimerTimeoutExpired(const CORE_TIMER_TIMEOUT *timeout);
+
+/************************************************************************************************
+ * Function    : void CoreTimerYield(const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Summary     : Idles the CPU for one poll of a blocking wait.
+ * 
+ * Description : Executes WAIT, which stops the CPU in Idle mode until the next interrupt.
+ *               The driver interrupts wake it as soon as the awaited event happens, the core
+ *               timer compare interrupt wakes it at the latest CORE_TIMER_YIELD_US later, or
+ *               when `timeout` expires if that comes first. The caller then checks its
+ *               condition again.
+ * 
+ * Parameters  :
+ *              timeout       - Timeout of the wait, or NULL when it has none.
+ * 
+ * Remarks     : Returns at once when interrupts are disabled, since nothing could wake the
+ *               CPU, and when CORE_TIMER_YIELD is false. Not for use from interrupts.
+ ************************************************************************************************/
+void CoreTimerYield(const CORE_TIMER_TIMEOUT *timeout);
+
+/************************************************************************************************
+ * Function    : void CoreTimerWakeTasks(void)
+ * 
+ * Summary     : Core timer compare interrupt handler, ends the sleep of CoreTimerYield.
+ * 
+ * Remarks     : Called from the core timer vector in system_interrupt.c.
+ ************************************************************************************************/
+void CoreTimerWakeTasks(void);
+
+
+#endif /* HAL_CORETIMER_H */
+/* *****************************************************************************
+ End of File
+ */
@@ -33,9 +33,19 @@ typedef enum
 	e_ERROR_UART_BUFFER_OVERFLOW = -3, // UART buffer overflow error (newly added)
 	e_UART_TIMEOUT = -4, // UART write timeout error
 	e_ERROR_UART_INVALID_POINTER = -5, // UART invalid pointer error
-	e_ERROR_FAILED_WRITE_UART = -6
+	e_ERROR_FAILED_WRITE_UART = -6,
+	e_ERROR_UART_TX_RING_FULL = -7, // UART transmit ring has no room for the data
+	e_ERROR_UART_QUEUE_FULL = -8, // All driver write queue slots hold packets in flight
+	e_ERROR_UART_STREAM_BUSY = -9 // A stream started with UartStreamWrite has not ended yet
 } e_UARTErrorCode_t;
 
+/* One piece of a vectored write: buffer and length in bytes */
+typedef DRV_USART_SEGMENT UART_SEGMENT;
+
+/* Called from the UART5 interrupt once a packet queued with UartWritePacketAsync has left,
+   with SUCCESS, or e_ERROR_FAILED_WRITE_UART when the driver failed or aborted it */
+typedef void (*UART_WRITE_CALLBACK)(int8_t status, uintptr_t context);
+
 /************************************************************************************************
  * Function    : int8_t UartWritePacket(char *uartBuffer,int writeCount) 
  * 
@@ -48,14 +58,22 @@ typedef enum
  *               It writes the specified number of bytes from the provided data buffer
  *               to the UART interface while handling errors such as invalid pointers,
  *               buffer overflows, or timeouts.
+ *               With DRV_USART_SUPPORT_TRANSMIT_DMA the packet goes through
+ *               `UartWritePacketAsync` and the function only waits until the DMA channel
+ *               has moved the last byte into the FIFO.
+ *               While waiting the CPU idles in `CoreTimerYield`. The timeout is measured
+ *               on the core timer and does not depend on the optimization level.
  * 
  * Parameters  :
  *              uartBuffer[]  - Data buffer containing the data to be sent via UART. Must not be NULL.
- *              writeCount    - The number of bytes to transmit. Must be less than MAX_FRAME_SIZE.
+ *              writeCount    - The number of bytes to transmit. Must be less than MAX_FRAME_SIZE,
+ *                              larger transfers go through UartStreamWrite.
  * 
  * Returns     :
  *              Status =  SUCCESS - Data was successfully written to UART.
- *              Status =  UART_TIMEOUT - Write operation failed due to timeout.
+ *              Status =  UART_TIMEOUT - The data did not leave within UART_WRITE_TIMEOUT_US.
+ *                        With DRV_USART_SUPPORT_TRANSMIT_DMA the channel is stopped and the
+ *                        write queue flushed first, so uartBuffer is free on return.
  *              Other error codes:
  *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
  *                  - e_ERROR_UART_BUFFER_OVERFLOW: writeCount exceeds MAX_FRAME_SIZE.
@@ -63,6 +81,197 @@ typedef enum
  ************************************************************************************************/
 int8_t UartWritePacket(char *uartBuffer, int writeCount);
 
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueued(char *uartBuffer, int writeCount)
+ * 
+ * Summary     : The `UartWriteQueued` function copies data into the UART5 transmit ring and
+ *               returns without waiting for the data to leave the wire.
+ * 
+ * Description : The data is copied into the normal driver transmit lane in one piece, or not
+ *               at all when the lane does not have room for it. The driver transmit tasks routine
+ *               drains the ring into the hardware FIFO in the background.
+ * 
+ * Parameters  :
+ *              uartBuffer[]  - Data buffer containing the data to be sent via UART. Must not be NULL.
+ *              writeCount    - The number of bytes to transmit. Must fit in the lane.
+ * 
+ * Returns     :
+ *              Status =  SUCCESS - Data was queued for transmission.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
+ *                  - e_ERROR_UART_BUFFER_OVERFLOW: writeCount does not fit in the lane.
+ *                  - e_ERROR_UART_TX_RING_FULL: The ring has no room, the data was dropped.
+ *                 -  e_NO_DATA: No data to write (writeCount = 0).
+ ************************************************************************************************/
+int8_t UartWriteQueued(char *uartBuffer, int writeCount);
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedHigh(char *uartBuffer, int writeCount)
+ * 
+ * Summary     : Same as `UartWriteQueued`, but queues the data on the high priority lane.
+ * 
+ * Description : The driver transmits records from the high priority lane before any record
+ *               waiting on the normal lane. A record already on the wire is finished first.
+ *               The lane has its own space, so a full normal lane cannot make it drop data.
+ * 
+ * Parameters  :
+ *              uartBuffer[]  - Data buffer containing the data to be sent via UART. Must not be NULL.
+ *              writeCount    - The number of bytes to transmit. Must fit in the high priority lane.
+ * 
+ * Returns     : Same status codes as UartWriteQueued.
+ ************************************************************************************************/
+int8_t UartWriteQueuedHigh(char *uartBuffer, int writeCount);
+
+/************************************************************************************************
+ * Function    : int8_t UartWritePacketV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Summary     : Transmits several separate pieces of memory back to back, as if they were
+ *               one buffer.
+ * 
+ * Description : A header, a payload and a trailer can be sent from where they are, in flash or
+ *               on the stack. The segments are gathered into one MAX_FRAME_SIZE buffer and sent
+ *               with a single UartWritePacket, so no record queued meanwhile can come out
+ *               between two of them.
+ * 
+ * Parameters  :
+ *              segments[]    - Pieces in wire order. Zero length pieces are skipped.
+ *              segmentCount  - Number of entries in segments.
+ * 
+ * Returns     :
+ *              Status =  SUCCESS - All segments were written.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: segments or a non-empty piece is NULL.
+ *                  - e_ERROR_BUFFER_SIZE_INVALID: segmentCount is negative.
+ *                  - e_ERROR_UART_BUFFER_OVERFLOW: The segments add up to MAX_FRAME_SIZE or more.
+ *                  - e_ERROR_UART_TX_RING_FULL: Without a transmit ring, a UartTxReserve
+ *                    reservation is open.
+ *                 -  e_NO_DATA: The segments hold no data.
+ *                  - Any error of UartWritePacket.
+ * 
+ * Remarks     : Not for use from interrupts, the gather buffer is shared.
+ ************************************************************************************************/
+int8_t UartWritePacketV(const UART_SEGMENT *segments, int segmentCount);
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Summary     : Same as `UartWriteQueued`, but gathers the record from several segments.
+ * 
+ * Description : The segments are copied straight into the normal transmit lane behind a single
+ *               record header, so they leave as one record and are never interleaved with
+ *               another one. The record is queued completely or not at all.
+ * 
+ * Parameters  :
+ *              segments[]    - Pieces in wire order. Zero length pieces are skipped.
+ *              segmentCount  - Number of entries in segments.
+ * 
+ * Returns     : Same status codes as UartWriteQueued.
+ ************************************************************************************************/
+int8_t UartWriteQueuedV(const UART_SEGMENT *segments, int segmentCount);
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedHighV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Summary     : Same as `UartWriteQueuedV`, but queues the record on the high priority lane.
+ ************************************************************************************************/
+int8_t UartWriteQueuedHighV(const UART_SEGMENT *segments, int segmentCount);
+
+/************************************************************************************************
+ * Function    : char *UartTxReserve(int reserveCount)
+ * 
+ * Summary     : Hands out room for one record directly in the UART5 normal transmit lane.
+ * 
+ * Description : The caller formats its record in place, then publishes it with `UartTxCommit`,
+ *               which needs no copy. The driver starts sending as soon as the commit happens.
+ *               The room is contiguous; when the end of the lane would split it, the driver
+ *               skips the rest of the lane. Without a transmit ring the room is a staging
+ *               buffer and the commit sends it with UartWritePacket.
+ * 
+ * Parameters  :
+ *              reserveCount  - Largest number of bytes the record can have.
+ * 
+ * Returns     : Start of the room, or NULL when the lane has no room for reserveCount
+ *               bytes (counted as a dropped record) or a reservation is already open.
+ * 
+ * Remarks     : Only one reservation is open at a time, and no other record can be queued
+ *               on the lane until it is committed. Not for use from interrupts.
+ ************************************************************************************************/
+char *UartTxReserve(int reserveCount);
+
+/************************************************************************************************
+ * Function    : char *UartTxReserveHigh(int reserveCount)
+ * 
+ * Summary     : Same as `UartTxReserve`, but on the high priority lane.
+ ************************************************************************************************/
+char *UartTxReserveHigh(int reserveCount);
+
+/************************************************************************************************
+ * Function    : int8_t UartTxCommit(int writeCount)
+ * 
+ * Summary     : Publishes the first writeCount bytes of the open reservation as one record.
+ * 
+ * Parameters  :
+ *              writeCount    - Bytes actually written, at most the reserved count. 0 gives
+ *                              the room back without sending anything.
+ * 
+ * Returns     :
+ *              Status =  SUCCESS - The record was queued for transmission.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: No reservation is open.
+ *                  - e_ERROR_BUFFER_SIZE_INVALID: writeCount is negative or above the
+ *                    reserved count, nothing was sent.
+ *                 -  e_NO_DATA: writeCount = 0, the reservation was dropped.
+ * 
+ * Remarks     : The reservation is closed in every case.
+ ************************************************************************************************/
+int8_t UartTxCommit(int writeCount);
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+/************************************************************************************************
+ * Function    : int8_t UartWritePacketAsync(char *uartBuffer, int writeCount,
+ *                                           UART_WRITE_CALLBACK callback, uintptr_t context)
+ * 
+ * Summary     : Queues a packet on the UART5 driver write queue and returns at once.
+ * 
+ * Description : The data is not copied. With DRV_USART_SUPPORT_TRANSMIT_DMA a DMA channel
+ *               moves it to the transmit FIFO, otherwise the transmit interrupt does. When
+ *               the last byte is in the FIFO `callback` is called with SUCCESS and `context`
+ *               from the interrupt, and the packet no longer counts in UartWritePacketPending.
+ *               A packet the driver fails or aborts is reported the same way with
+ *               e_ERROR_FAILED_WRITE_UART.
+ *               Up to DRV_USART_XMIT_QUEUE_SIZE_IDX0 packets can be in flight.
+ * 
+ * Parameters  :
+ *              uartBuffer[]  - Data to send. Must stay unchanged until the packet is complete.
+ *              writeCount    - The number of bytes to transmit. Must be less than MAX_FRAME_SIZE,
+ *                              like for UartWritePacket.
+ *              callback      - Completion callback, or NULL to poll UartWritePacketPending.
+ *              context       - Passed to the callback.
+ * 
+ * Returns     :
+ *              Status =  SUCCESS - The packet was queued.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
+ *                  - e_ERROR_BUFFER_SIZE_INVALID: writeCount is negative or not below
+ *                    MAX_FRAME_SIZE.
+ *                  - e_ERROR_UART_QUEUE_FULL: No free slot, nothing was queued.
+ *                 -  e_NO_DATA: No data to write (writeCount = 0).
+ * 
+ * Remarks     : The HAL owns the driver buffer event handler. Read buffers and write buffers
+ *               queued directly with the driver may be used next to this function, their
+ *               events are not reported to any callback.
+ ************************************************************************************************/
+int8_t UartWritePacketAsync(char *uartBuffer, int writeCount, UART_WRITE_CALLBACK callback, uintptr_t context);
+
+/************************************************************************************************
+ * Function    : uint8_t UartWritePacketPending(void)
+ * 
+ * Summary     : Returns the number of packets queued with UartWritePacketAsync that have not
+ *               completed yet.
+ ************************************************************************************************/
+uint8_t UartWritePacketPending(void);
+#endif
+
 
 #endif /* _HAL_UARTPRINT_H */
 /* *****************************************************************************
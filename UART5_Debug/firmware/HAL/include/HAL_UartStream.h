@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   : HAL_UartStream.h
+
+  Summary     : Streaming of transfers larger than MAX_FRAME_SIZE over UART5.
+
+  Description : A stream moves a caller buffer of any size, or the output of a
+				producer callback, into the UART5 normal transmit lane in chunks of
+				UART_STREAM_CHUNK bytes. `UartStreamTasks`, called once per
+				SYS_Tasks pass, moves chunks until the lane is half full or
+				UART_STREAM_BUDGET_US has passed, so a memory or trace dump never
+				holds up the rest of the main loop. Lengths and progress are
+				counted in 32 bits.
+ ************************************************************************* */
+
+#ifndef HAL_UARTSTREAM_H
+#define HAL_UARTSTREAM_H
+
+/* Progress of the stream */
+typedef enum
+{
+	UART_STREAM_IDLE = 0, // No stream was started
+	UART_STREAM_BUSY, // Chunks are still being moved
+	UART_STREAM_DONE, // All bytes are queued for transmission
+	UART_STREAM_ABORTED // Stopped by UartStreamAbort or a failed chunk
+} UART_STREAM_STATE;
+
+/* Snapshot of the stream, see UartStreamStatusGet */
+typedef struct
+{
+	UART_STREAM_STATE state;
+
+	/* Bytes queued for transmission so far */
+	uint32_t sent;
+
+	/* Length of the stream, 0 while a producer has not ended it */
+	uint32_t total;
+} UART_STREAM_STATUS;
+
+/* Fills chunk with up to chunkMax bytes and returns how many it wrote, 0 ends the stream */
+typedef uint32_t (*UART_STREAM_PRODUCER)(char *chunk, uint32_t chunkMax, uintptr_t context);
+
+/* Called from UartStreamTasks after every pass that moved data, and once when the stream ends
+   there. Not called for UartStreamAbort. */
+typedef void (*UART_STREAM_PROGRESS)(const UART_STREAM_STATUS *status, uintptr_t context);
+
+/************************************************************************************************
+ * Function    : int8_t UartStreamWrite(const char *buffer, uint32_t length,
+ *                                      UART_STREAM_PROGRESS progress, uintptr_t context)
+ *
+ * Summary     : Starts streaming a buffer of any length over UART5.
+ *
+ * Description : Only records the buffer; `UartStreamTasks` copies it out chunk by chunk.
+ *
+ * Parameters  :
+ *              buffer        - Data to send. Must stay unchanged until the stream has ended.
+ *              length        - Number of bytes to send.
+ *              progress      - Progress callback, or NULL to poll UartStreamStatusGet.
+ *              context       - Passed to the callback.
+ *
+ * Returns     :
+ *              Status =  SUCCESS - The stream was started.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
+ *                  - e_ERROR_UART_STREAM_BUSY: Another stream has not ended yet.
+ *                 -  e_NO_DATA: No data to write (length = 0).
+ ************************************************************************************************/
+int8_t UartStreamWrite(const char *buffer, uint32_t length, UART_STREAM_PROGRESS progress, uintptr_t context);
+
+/************************************************************************************************
+ * Function    : int8_t UartStreamProduce(UART_STREAM_PRODUCER producer, UART_STREAM_PROGRESS progress,
+ *                                        uintptr_t context)
+ *
+ * Summary     : Starts a stream whose data is generated chunk by chunk by a callback.
+ *
+ * Description : `UartStreamTasks` calls `producer` with room for the next chunk directly in
+ *               the transmit lane. The stream ends when the producer returns 0.
+ *
+ * Parameters  :
+ *              producer      - Chunk producer, called from UartStreamTasks.
+ *              progress      - Progress callback, or NULL to poll UartStreamStatusGet.
+ *              context       - Passed to both callbacks.
+ *
+ * Returns     :
+ *              Status =  SUCCESS - The stream was started.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: Producer pointer is NULL.
+ *                  - e_ERROR_UART_STREAM_BUSY: Another stream has not ended yet.
+ ************************************************************************************************/
+int8_t UartStreamProduce(UART_STREAM_PRODUCER producer, UART_STREAM_PROGRESS progress, uintptr_t context);
+
+/************************************************************************************************
+ * Function    : void UartStreamTasks(void)
+ *
+ * Summary     : Moves the next chunks of the running stream into the transmit lane.
+ *
+ * Description : Stops when the stream ends, when the normal lane is half full, so that log
+ *               records still find room, or when UART_STREAM_BUDGET_US has passed since the
+ *               call. A chunk that has been started is always finished, so the budget can be
+ *               overrun by the time one chunk of UART_STREAM_CHUNK bytes takes.
+ *
+ * Remarks     : Called from SYS_Tasks. Without a transmit ring every chunk is sent with
+ *               UartWritePacket and blocks until it is on the wire, keep UART_STREAM_CHUNK
+ *               small in that configuration.
+ ************************************************************************************************/
+void UartStreamTasks(void);
+
+/************************************************************************************************
+ * Function    : void UartStreamStatusGet(UART_STREAM_STATUS *status)
+ *
+ * Summary     : Returns the state of the current or last stream and the bytes it has sent.
+ ************************************************************************************************/
+void UartStreamStatusGet(UART_STREAM_STATUS *status);
+
+/************************************************************************************************
+ * Function    : void UartStreamAbort(void)
+ *
+ * Summary     : Ends the running stream. Chunks already queued are still transmitted.
+ ************************************************************************************************/
+void UartStreamAbort(void);
+
+
+#endif /* HAL_UARTSTREAM_H */
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,191 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   :  HAL_CoreTimer.c
+
+  Summary     : This file contains the 64-bit core timer time base.
+
+  Description : This file contains "CoreTimerGet64", which extends the 32-bit
+              CP0 Count register to 64 bits, "CoreTimerDeltaGet", which
+              measures the time between two events, the microsecond timeouts
+              and "CoreTimerYield", which sleeps inside a blocking wait.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <xc.h>
+#include "app.h"
+
+
+/* Section: File Scope Data                                                   */
+
+/* Count register value at the previous read */
+static uint32_t coreTimerLast = RESET;
+
+/* Software extension, number of Count register wraps seen */
+static uint32_t coreTimerHigh = RESET;
+
+#if (CORE_TIMER_YIELD == true)
+/* Shortest distance between Count and a new Compare value, so that Count
+   cannot pass Compare before the write lands and postpone the wake up by
+   a full 2^32 tick wrap */
+#define CORE_TIMER_YIELD_MIN_TICKS  (1U * CORE_TIMER_TICKS_PER_US)
+
+/* True while CoreTimerYield may be sleeping, the compare interrupt then
+   keeps firing every CORE_TIMER_YIELD_US so a wake up cannot be lost */
+static volatile bool coreTimerYielding = false;
+#endif
+
+
+/* Section: Interface Functions                                         */
+
+/************************************************************************************************
+ * Function    : uint64_t CoreTimerGet64(void)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+uint64_t CoreTimerGet64(void)
+{
+    bool interruptState;
+    uint32_t count;
+    uint64_t ticks;
+
+    interruptState = SYS_INT_Disable();
+
+    count = _CP0_GET_COUNT();
+    if(count < coreTimerLast)
+    {
+        coreTimerHigh++;
+    }
+    coreTimerLast = count;
+    ticks = ((uint64_t)coreTimerHigh << 32) | count;
+
+    SYS_INT_Restore(interruptState);
+
+    return ticks;
+}
+
+/************************************************************************************************
+ * Function    : uint64_t CoreTimerDeltaGet(uint64_t *reference)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+uint64_t CoreTimerDeltaGet(uint64_t *reference)
+{
+    uint64_t now = CoreTimerGet64();
+    uint64_t delta = now - *reference;
+
+    *reference = now;
+    return delta;
+}
+
+/************************************************************************************************
+ * Function    : void CoreTimerTimeoutStart(CORE_TIMER_TIMEOUT *timeout, uint32_t microseconds)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+void CoreTimerTimeoutStart(CORE_TIMER_TIMEOUT *timeout, uint32_t microseconds)
+{
+    timeout->deadline = CoreTimerGet64() + ((uint64_t)microseconds * CORE_TIMER_TICKS_PER_US);
+}
+
+/************************************************************************************************
+ * Function    : bool CoreTimerTimeoutExpired(const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+bool CoreTimerTimeoutExpired(const CORE_TIMER_TIMEOUT *timeout)
+{
+    return (CoreTimerGet64() >= timeout->deadline);
+}
+
+/************************************************************************************************
+ * Function    : void CoreTimerYield(const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+void CoreTimerYield(const CORE_TIMER_TIMEOUT *timeout)
+{
+#if (CORE_TIMER_YIELD == true)
+    bool interruptState;
+    uint64_t now;
+    uint32_t sleepTicks = CORE_TIMER_YIELD_US * CORE_TIMER_TICKS_PER_US;
+
+    if(!SYS_INT_IsEnabled())
+    {
+        return;
+    }
+
+    if(timeout != NULL)
+    {
+        now = CoreTimerGet64();
+        if(now >= timeout->deadline)
+        {
+            return;
+        }
+        if((timeout->deadline - now) < sleepTicks)
+        {
+            sleepTicks = (uint32_t)(timeout->deadline - now);
+        }
+    }
+    if(sleepTicks < CORE_TIMER_YIELD_MIN_TICKS)
+    {
+        sleepTicks = CORE_TIMER_YIELD_MIN_TICKS;
+    }
+
+    /* If the compare interrupt fires before WAIT, its handler arms the
+       next one, so the sleep still ends within CORE_TIMER_YIELD_US */
+    coreTimerYielding = true;
+
+    /* A stale flag is dropped first, clearing it after the new Compare
+       could swallow a match that has already happened */
+    SYS_INT_SourceStatusClear(INT_SOURCE_TIMER_CORE);
+
+    /* No interrupt between reading Count and writing Compare, so the
+       margin holds */
+    interruptState = SYS_INT_Disable();
+    _CP0_SET_COMPARE(_CP0_GET_COUNT() + sleepTicks);
+    SYS_INT_Restore(interruptState);
+
+    SYS_INT_SourceEnable(INT_SOURCE_TIMER_CORE);
+
+    _wait();
+
+    coreTimerYielding = false;
+#else
+    (void)timeout;
+#endif
+}
+
+/************************************************************************************************
+ * Function    : void CoreTimerWakeTasks(void)
+ * 
+ * Remarks     : See prototype in HAL_CoreTimer.h.
+ ************************************************************************************************/
+void CoreTimerWakeTasks(void)
+{
+#if (CORE_TIMER_YIELD == true)
+    if(coreTimerYielding)
+    {
+        /* Writing Compare also clears the pending match */
+        _CP0_SET_COMPARE(_CP0_GET_COUNT() + (CORE_TIMER_YIELD_US * CORE_TIMER_TICKS_PER_US));
+    }
+    else
+    {
+        SYS_INT_SourceDisable(INT_SOURCE_TIMER_CORE);
+    }
+    SYS_INT_SourceStatusClear(INT_SOURCE_TIMER_CORE);
+#endif
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -19,9 +19,298 @@
 /* Section: Included Files                                                    */
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
+
+/* Log call sites in this file belong to the HAL module */
+#define APP_LOG_MODULE  APP_LOG_MODULE_HAL
 #include "app.h"
 
 
+/* Section: File Scope Data                                                   */
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+/* Completion callback of one packet in the driver write queue */
+typedef struct
+{
+    DRV_USART_BUFFER_HANDLE bufferHandle;
+    UART_WRITE_CALLBACK callback;
+    uintptr_t context;
+} UART_WRITE_PENDING;
+
+/* Packets in flight in driver queue order. UartWritePacketAsync fills the
+   head, UartWriteEventHandler empties the tail. */
+static UART_WRITE_PENDING uartWritePending[DRV_USART_XMIT_QUEUE_SIZE_IDX0];
+static volatile uint8_t uartWritePendingHead = RESET;
+static volatile uint8_t uartWritePendingTail = RESET;
+
+/* True once UartWriteEventHandler is registered with the driver */
+static bool uartWriteHandlerSet = false;
+#endif
+
+/* Bytes handed out by UartTxReserve or UartTxReserveHigh, 0 when none are */
+static int uartTxReserved = RESET;
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+/* Lane the open reservation belongs to */
+static DRV_USART_TX_LANE uartTxReserveLane = DRV_USART_TX_LANE_NORMAL;
+#endif
+
+/* Packet gathered by UartWritePacketV. Without a transmit ring it also stands in
+   for the ring between UartTxReserve and UartTxCommit. */
+static char uartTxStaging[MAX_FRAME_SIZE];
+
+
+/* Section: Local Functions                                                   */
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+/************************************************************************************************
+ * Function    : static void UartWriteEventHandler(DRV_USART_BUFFER_EVENT event,
+ *                                                 DRV_USART_BUFFER_HANDLE bufferHandle,
+ *                                                 uintptr_t context)
+ * 
+ * Summary     : Driver buffer event handler, completes the oldest packet in flight.
+ * 
+ * Remarks     : Runs in the UART5 or DMA interrupt, or in DRV_USART0_BufferAbortWrite. The
+ *               driver completes write buffers in queue order. Events of read buffers and of
+ *               write buffers other modules queued carry a handle that is not the oldest
+ *               packet's and are ignored.
+ ************************************************************************************************/
+static void UartWriteEventHandler(DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE bufferHandle,
+                                  uintptr_t context)
+{
+    UART_WRITE_PENDING *pending;
+    uint8_t tail = uartWritePendingTail;
+
+    if(tail != uartWritePendingHead)
+    {
+        pending = &uartWritePending[tail & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+        if(pending->bufferHandle == bufferHandle)
+        {
+            uartWritePendingTail = tail + 1;
+
+            if(pending->callback != NULL)
+            {
+                pending->callback((event == DRV_USART_BUFFER_EVENT_COMPLETE) ? SUCCESS : e_ERROR_FAILED_WRITE_UART,
+                                  pending->context);
+            }
+        }
+    }
+}
+#endif
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+/************************************************************************************************
+ * Function    : static int8_t UartWritePacketQueue(char *uartBuffer, int writeCount,
+ *                                                 const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Summary     : Queues a packet for the DMA channel, sleeping while the write queue is full.
+ * 
+ * Returns     : Same as UartWritePacketAsync, or e_UART_TIMEOUT when no slot came free
+ *               before `timeout` expired.
+ ************************************************************************************************/
+static int8_t UartWritePacketQueue(char *uartBuffer, int writeCount, const CORE_TIMER_TIMEOUT *timeout)
+{
+    int8_t status;
+
+    status = UartWritePacketAsync(uartBuffer, writeCount, NULL, (uintptr_t)NULL);
+    while(status == e_ERROR_UART_QUEUE_FULL)
+    {
+        if(CoreTimerTimeoutExpired(timeout))
+        {
+            status = e_UART_TIMEOUT;
+        }
+        else
+        {
+            /* The DMA interrupt of the oldest packet wakes us */
+            CoreTimerYield(timeout);
+            status = UartWritePacketAsync(uartBuffer, writeCount, NULL, (uintptr_t)NULL);
+        }
+    }
+    return status;
+}
+
+/************************************************************************************************
+ * Function    : static int8_t UartWritePacketDrain(const CORE_TIMER_TIMEOUT *timeout)
+ * 
+ * Summary     : Sleeps until the DMA channel is done with every queued packet.
+ * 
+ * Returns     : SUCCESS, or e_UART_TIMEOUT when packets were still pending once `timeout`
+ *               expired.
+ * 
+ * Remarks     : The channel always finishes since flow control cannot be combined with DMA,
+ *               so the timeout only ends the wait on a stopped UART. The channel is then
+ *               stopped and every queued packet fails, so no caller buffer is read after
+ *               the return. Packets of UartWritePacketAsync callers fail with them.
+ ************************************************************************************************/
+static int8_t UartWritePacketDrain(const CORE_TIMER_TIMEOUT *timeout)
+{
+    while(UartWritePacketPending() != ZERO)
+    {
+        if(CoreTimerTimeoutExpired(timeout))
+        {
+            /* The event handler completes every pending packet as failed */
+            DRV_USART0_BufferAbortWrite();
+            return e_UART_TIMEOUT;
+        }
+        CoreTimerYield(timeout);
+    }
+    return SUCCESS;
+}
+#endif
+
+
+/************************************************************************************************
+ * Function    : static char *UartTxReserveLane(uint8_t lane, int reserveCount)
+ * 
+ * Summary     : Opens a reservation on the given UART5 transmit lane.
+ * 
+ * Parameters  :
+ *              lane          - DRV_USART_TX_LANE of the record, ignored without transmit ring.
+ *              reserveCount  - Largest number of bytes the record can have.
+ * 
+ * Returns     : Same as UartTxReserve.
+ ************************************************************************************************/
+static char *UartTxReserveLane(uint8_t lane, int reserveCount)
+{
+    char *reservation = NULL;
+
+    if((reserveCount > ZERO) && (uartTxReserved == RESET))
+    {
+#if (DRV_USART_TX_RING_SUPPORT == true)
+        reservation = (char *)DRV_USART0_TxLaneReserve((DRV_USART_TX_LANE)lane, (size_t)reserveCount);
+        uartTxReserveLane = (DRV_USART_TX_LANE)lane;
+#else
+        if(reserveCount < MAX_FRAME_SIZE)
+        {
+            reservation = uartTxStaging;
+        }
+#endif
+        if(reservation != NULL)
+        {
+            uartTxReserved = reserveCount;
+        }
+    }
+    return reservation;
+}
+
+/************************************************************************************************
+ * Function    : static int8_t UartSegmentsCheck(const UART_SEGMENT *segments, int segmentCount,
+ *                                               size_t *total)
+ * 
+ * Summary     : Validates a segment list and adds up its length.
+ * 
+ * Returns     : SUCCESS, or the status code the vectored write functions return for the list.
+ ************************************************************************************************/
+static int8_t UartSegmentsCheck(const UART_SEGMENT *segments, int segmentCount, size_t *total)
+{
+    int index;
+
+    *total = RESET;
+
+    if(segments == NULL)
+    {
+        return e_ERROR_UART_INVALID_POINTER;
+    }
+    if(segmentCount < ZERO)
+    {
+        return e_ERROR_BUFFER_SIZE_INVALID;
+    }
+
+    for(index = ZERO; index < segmentCount; index++)
+    {
+        if((segments[index].buffer == NULL) && (segments[index].length != ZERO))
+        {
+            return e_ERROR_UART_INVALID_POINTER;
+        }
+        *total += segments[index].length;
+    }
+
+    if(*total == ZERO)
+    {
+        return e_NO_DATA;
+    }
+    return SUCCESS;
+}
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+/************************************************************************************************
+ * Function    : static int8_t UartWriteLaneV(DRV_USART_TX_LANE lane, const UART_SEGMENT *segments,
+ *                                            int segmentCount)
+ * 
+ * Summary     : Copies the segments into the given UART5 transmit lane as one record.
+ * 
+ * Returns     : Same status codes as UartWriteQueuedV.
+ ************************************************************************************************/
+static int8_t UartWriteLaneV(DRV_USART_TX_LANE lane, const UART_SEGMENT *segments, int segmentCount)
+{
+    int8_t status;
+    size_t total;
+    DRV_USART_TX_RING_STATUS ringStatus;
+
+    status = UartSegmentsCheck(segments, segmentCount, &total);
+    if(status == SUCCESS)
+    {
+        DRV_USART0_TxRingStatusGet(lane, &ringStatus);
+
+        if(total > (ringStatus.size - _DRV_USART_TX_RECORD_HEADER))
+        {
+            status = e_ERROR_UART_BUFFER_OVERFLOW;
+        }
+        else if(DRV_USART0_TxLaneWriteV(lane, segments, (size_t)segmentCount) == NO_DATA)
+        {
+            status = e_ERROR_UART_TX_RING_FULL;
+        }
+        else
+        {
+            // MISRA-C 2023
+        }
+    }
+    return status;
+}
+
+/************************************************************************************************
+ * Function    : static int8_t UartWriteLane(DRV_USART_TX_LANE lane, char *uartBuffer, int writeCount)
+ * 
+ * Summary     : Copies one record into the given UART5 transmit lane.
+ * 
+ * Returns     : Same status codes as UartWriteQueued.
+ ************************************************************************************************/
+static int8_t UartWriteLane(DRV_USART_TX_LANE lane, char *uartBuffer, int writeCount)
+{
+    int8_t status = SUCCESS;
+    DRV_USART_TX_RING_STATUS ringStatus;
+
+    DRV_USART0_TxRingStatusGet(lane, &ringStatus);
+
+    if(uartBuffer == NULL)
+    {
+        status = e_ERROR_UART_INVALID_POINTER;
+    }
+    else if(writeCount == NO_DATA)
+    {
+        status = e_NO_DATA;
+    }
+    else if(writeCount < ZERO)
+    {
+        status = e_ERROR_BUFFER_SIZE_INVALID;
+    }
+    else if((uint32_t)writeCount > (ringStatus.size - _DRV_USART_TX_RECORD_HEADER))
+    {
+        status = e_ERROR_UART_BUFFER_OVERFLOW;
+    }
+    else if(DRV_USART0_TxLaneWrite(lane, uartBuffer, writeCount) == NO_DATA)
+    {
+        status = e_ERROR_UART_TX_RING_FULL;
+    }
+    else
+    {
+        // MISRA-C 2023
+    }
+    return status;
+}
+#endif
+
+
 /* Section: Interface Functions                                         */
 
 /************************************************************************************************
@@ -36,14 +325,20 @@
  *               It writes the specified number of bytes from the provided data buffer
  *               to the UART interface while handling errors such as invalid pointers,
  *               buffer overflows, or timeouts.
+ *               With DRV_USART_SUPPORT_TRANSMIT_DMA the packet goes through
+ *               `UartWritePacketAsync` and the function only waits until the DMA channel
+ *               has moved the last byte into the FIFO.
+ *               While waiting the CPU idles in `CoreTimerYield`. The timeout is measured
+ *               on the core timer and does not depend on the optimization level.
  * 
  * Parameters  :
  *              uartBuffer[]  - Data buffer containing the data to be sent via UART. Must not be NULL.
- *              writeCount    - The number of bytes to transmit. Must be less than MAX_FRAME_SIZE.
+ *              writeCount    - The number of bytes to transmit. Must be less than MAX_FRAME_SIZE,
+ *                              larger transfers go through UartStreamWrite.
  * 
  * Returns     :
  *              Status =  SUCCESS - Data was successfully written to UART.
- *              Status =  UART_TIMEOUT - Write operation failed due to timeout.
+ *              Status =  UART_TIMEOUT - The data did not leave within UART_WRITE_TIMEOUT_US.
  *              Other error codes:
  *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
  *                  - e_ERROR_UART_BUFFER_OVERFLOW: writeCount exceeds MAX_FRAME_SIZE.
@@ -52,9 +347,13 @@
 int8_t UartWritePacket(char *uartBuffer,int writeCount)
 {
     int8_t status = SUCCESS;
-    int8_t resultValue = RESET;
-    int8_t currentCount = RESET;
-    uint16_t uartWriteTimeout = RESET;
+    CORE_TIMER_TIMEOUT timeout;
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == false)
+    size_t resultValue = RESET;
+    int currentCount = RESET;
+#endif
+
+    CoreTimerTimeoutStart(&timeout, UART_WRITE_TIMEOUT_US);
 
     if(uartBuffer == NULL)
     {
@@ -72,37 +371,313 @@ int8_t UartWritePacket(char *uartBuffer,int writeCount)
     {
         status = e_ERROR_BUFFER_SIZE_INVALID;
     }
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    else
+    {
+        /* The DMA channel reads the caller's buffer, wait until it is done with it */
+        status = UartWritePacketQueue(uartBuffer, writeCount, &timeout);
+        if(status == SUCCESS)
+        {
+            status = UartWritePacketDrain(&timeout);
+        }
+    }
+#else
     else
     {
-        while(currentCount <= writeCount)
+        while(currentCount < writeCount)
         {
-            if(uartWriteTimeout <= UART_WRITE_TIMEOUT)
+            resultValue = DRV_USART0_Write(&uartBuffer[currentCount],writeCount - currentCount);
+            if(resultValue == DRV_USART_WRITE_ERROR)
             {
-                if(currentCount < writeCount)
-                {
-                    resultValue = DRV_USART0_Write(&uartBuffer[currentCount],writeCount - currentCount);
-                    if(resultValue < RESET)
-                    {
-                        status = e_ERROR_FAILED_WRITE_UART;
-                    }
-                    else
-                    {
-                        currentCount += resultValue;
-                    }
-                }
-                else
-                {
-                    // MISRA-C 2023
-                }
+                status = e_ERROR_FAILED_WRITE_UART;
+                break;
             }
-            else
+            currentCount += (int)resultValue;
+
+            if(currentCount >= writeCount)
+            {
+                // MISRA-C 2023
+            }
+            else if(CoreTimerTimeoutExpired(&timeout))
             {
                 status = e_UART_TIMEOUT;
                 break;
             }
-            ++uartWriteTimeout;
+            else if(resultValue == NO_DATA)
+            {
+                /* FIFO full, idle until it has drained a little */
+                CoreTimerYield(&timeout);
+            }
+            else
+            {
+                // MISRA-C 2023
+            }
+        }
+    }
+#endif
+    return status;
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueued(char *uartBuffer,int writeCount)
+ * 
+ * Summary     : The `UartWriteQueued` function copies data into the UART5 transmit ring and
+ *               returns without waiting for the data to leave the wire.
+ * 
+ * Description : The data is copied into the driver transmit ring in one piece, or not at all
+ *               when the ring does not have room for it. The driver transmit tasks routine
+ *               drains the ring into the hardware FIFO in the background.
+ * 
+ * Parameters  :
+ *              uartBuffer[]  - Data buffer containing the data to be sent via UART. Must not be NULL.
+ *              writeCount    - The number of bytes to transmit. Must not exceed the ring size.
+ * 
+ * Returns     :
+ *              Status =  SUCCESS - Data was queued for transmission.
+ *              Other error codes:
+ *                  - e_ERROR_UART_INVALID_POINTER: Buffer pointer is NULL.
+ *                  - e_ERROR_UART_BUFFER_OVERFLOW: writeCount exceeds the ring size.
+ *                  - e_ERROR_UART_TX_RING_FULL: The ring has no room, the data was dropped.
+ *                 -  e_NO_DATA: No data to write (writeCount = 0).
+ ************************************************************************************************/
+int8_t UartWriteQueued(char *uartBuffer,int writeCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartWriteLane(DRV_USART_TX_LANE_NORMAL, uartBuffer, writeCount);
+#else
+    /* No transmit ring configured, fall back to the blocking path */
+    return UartWritePacket(uartBuffer, writeCount);
+#endif
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedHigh(char *uartBuffer, int writeCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartWriteQueuedHigh(char *uartBuffer,int writeCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartWriteLane(DRV_USART_TX_LANE_HIGH, uartBuffer, writeCount);
+#else
+    /* No transmit ring configured, fall back to the blocking path */
+    return UartWritePacket(uartBuffer, writeCount);
+#endif
+}
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+/************************************************************************************************
+ * Function    : int8_t UartWritePacketAsync(char *uartBuffer, int writeCount,
+ *                                           UART_WRITE_CALLBACK callback, uintptr_t context)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartWritePacketAsync(char *uartBuffer, int writeCount, UART_WRITE_CALLBACK callback, uintptr_t context)
+{
+    int8_t status = SUCCESS;
+    DRV_USART_BUFFER_HANDLE bufferHandle;
+    UART_WRITE_PENDING *pending;
+    uint8_t head = uartWritePendingHead;
+    bool interruptState;
+
+    if(uartBuffer == NULL)
+    {
+        status = e_ERROR_UART_INVALID_POINTER;
+    }
+    else if(writeCount == NO_DATA)
+    {
+        status = e_NO_DATA;
+    }
+    else if((writeCount < ZERO) || (writeCount >= MAX_FRAME_SIZE))
+    {
+        status = e_ERROR_BUFFER_SIZE_INVALID;
+    }
+    else if((uint8_t)(head - uartWritePendingTail) >= DRV_USART_XMIT_QUEUE_SIZE_IDX0)
+    {
+        status = e_ERROR_UART_QUEUE_FULL;
+    }
+    else
+    {
+        if(!uartWriteHandlerSet)
+        {
+            DRV_USART0_BufferEventHandlerSet(UartWriteEventHandler, (uintptr_t)NULL);
+            uartWriteHandlerSet = true;
+        }
+
+        /* The handle is only known once the driver has the packet. Hold the
+           interrupts off until it is published, or the handler could see the
+           packet complete before it knows the handle. */
+        interruptState = SYS_INT_Disable();
+
+        DRV_USART0_BufferAddWrite(&bufferHandle, uartBuffer, (size_t)writeCount);
+        if(bufferHandle == DRV_USART_BUFFER_HANDLE_INVALID)
+        {
+            status = e_ERROR_UART_QUEUE_FULL;
+        }
+        else
+        {
+            pending = &uartWritePending[head & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+            pending->bufferHandle = bufferHandle;
+            pending->callback = callback;
+            pending->context = context;
+            uartWritePendingHead = head + 1;
         }
+
+        SYS_INT_Restore(interruptState);
+    }
+    return status;
+}
+
+/************************************************************************************************
+ * Function    : uint8_t UartWritePacketPending(void)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+uint8_t UartWritePacketPending(void)
+{
+    return (uint8_t)(uartWritePendingHead - uartWritePendingTail);
+}
+#endif
+
+/************************************************************************************************
+ * Function    : int8_t UartWritePacketV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartWritePacketV(const UART_SEGMENT *segments, int segmentCount)
+{
+    int8_t status;
+    size_t total;
+    size_t length = RESET;
+    int index;
+
+    status = UartSegmentsCheck(segments, segmentCount, &total);
+    if(status != SUCCESS)
+    {
+        return status;
+    }
+    if(total >= MAX_FRAME_SIZE)
+    {
+        return e_ERROR_UART_BUFFER_OVERFLOW;
+    }
+#if (DRV_USART_TX_RING_SUPPORT == false)
+    if(uartTxReserved != RESET)
+    {
+        /* The staging buffer holds the open reservation */
+        return e_ERROR_UART_TX_RING_FULL;
+    }
+#endif
+
+    /* One packet, so nothing queued meanwhile can come out between two segments */
+    for(index = ZERO; index < segmentCount; index++)
+    {
+        memcpy(&uartTxStaging[length], segments[index].buffer, segments[index].length);
+        length += segments[index].length;
+    }
+    return UartWritePacket(uartTxStaging, (int)length);
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartWriteQueuedV(const UART_SEGMENT *segments, int segmentCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartWriteLaneV(DRV_USART_TX_LANE_NORMAL, segments, segmentCount);
+#else
+    /* No transmit ring configured, fall back to the blocking path */
+    return UartWritePacketV(segments, segmentCount);
+#endif
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartWriteQueuedHighV(const UART_SEGMENT *segments, int segmentCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartWriteQueuedHighV(const UART_SEGMENT *segments, int segmentCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartWriteLaneV(DRV_USART_TX_LANE_HIGH, segments, segmentCount);
+#else
+    /* No transmit ring configured, fall back to the blocking path */
+    return UartWritePacketV(segments, segmentCount);
+#endif
+}
+
+/************************************************************************************************
+ * Function    : char *UartTxReserve(int reserveCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+char *UartTxReserve(int reserveCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartTxReserveLane((uint8_t)DRV_USART_TX_LANE_NORMAL, reserveCount);
+#else
+    return UartTxReserveLane(ZERO, reserveCount);
+#endif
+}
+
+/************************************************************************************************
+ * Function    : char *UartTxReserveHigh(int reserveCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+char *UartTxReserveHigh(int reserveCount)
+{
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    return UartTxReserveLane((uint8_t)DRV_USART_TX_LANE_HIGH, reserveCount);
+#else
+    return UartTxReserveLane(ZERO, reserveCount);
+#endif
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartTxCommit(int writeCount)
+ * 
+ * Remarks     : See prototype in HAL_UartPrint.h.
+ ************************************************************************************************/
+int8_t UartTxCommit(int writeCount)
+{
+    int8_t status = SUCCESS;
+    int reserved = uartTxReserved;
+
+    /* The reservation is closed whatever happens next */
+    uartTxReserved = RESET;
+
+    if(reserved == RESET)
+    {
+        status = e_ERROR_UART_INVALID_POINTER;
+    }
+    else if(writeCount == NO_DATA)
+    {
+        status = e_NO_DATA;
+    }
+    else if((writeCount < ZERO) || (writeCount > reserved))
+    {
+        status = e_ERROR_BUFFER_SIZE_INVALID;
+        writeCount = ZERO;
+    }
+    else
+    {
+        // MISRA-C 2023
+    }
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    if(reserved != RESET)
+    {
+        /* A count of zero gives the space back without sending anything */
+        (void)DRV_USART0_TxLaneCommit(uartTxReserveLane, (size_t)((status == SUCCESS) ? writeCount : ZERO));
+    }
+#else
+    if(status == SUCCESS)
+    {
+        status = UartWritePacket(uartTxStaging, writeCount);
     }
+#endif
     return status;
 }
 
@@ -0,0 +1,246 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author	  : Krushna C
+
+  Created 	  : 17 October 2026
+
+  File Name   :  HAL_UartStream.c
+
+  Summary     : This file contains the UART5 streaming of large transfers.
+
+  Description : This file contains "UartStreamWrite" and "UartStreamProduce",
+              which start a stream, and "UartStreamTasks", which moves it into
+              the normal transmit lane one reserved chunk at a time within a
+              time budget per SYS_Tasks pass.
+ */
+/* ************************************************************************** */
+
+
+/* Section: Included Files                                                    */
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "app.h"
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+#if (UART_STREAM_CHUNK > (DRV_USART_TX_RING_SIZE_IDX0 / 2))
+#error "UART_STREAM_CHUNK must fit in half of the normal transmit lane"
+#endif
+#else
+#if (UART_STREAM_CHUNK >= MAX_FRAME_SIZE)
+#error "UART_STREAM_CHUNK must be below MAX_FRAME_SIZE without a transmit ring"
+#endif
+#endif
+
+
+/* Section: File Scope Data                                                   */
+
+static UART_STREAM_STATUS streamStatus = { UART_STREAM_IDLE, RESET, RESET };
+
+/* Source of the stream, a buffer or a producer */
+static const char *streamBuffer = NULL;
+static UART_STREAM_PRODUCER streamProducer = NULL;
+
+static UART_STREAM_PROGRESS streamProgress = NULL;
+static uintptr_t streamContext = RESET;
+
+
+/* Section: Local Functions                                                   */
+
+/************************************************************************************************
+ * Function    : static int8_t UartStreamStart(const char *buffer, uint32_t length,
+ *                                             UART_STREAM_PRODUCER producer,
+ *                                             UART_STREAM_PROGRESS progress, uintptr_t context)
+ *
+ * Summary     : Records the source of a new stream unless one is running.
+ ************************************************************************************************/
+static int8_t UartStreamStart(const char *buffer, uint32_t length, UART_STREAM_PRODUCER producer,
+                              UART_STREAM_PROGRESS progress, uintptr_t context)
+{
+    if(streamStatus.state == UART_STREAM_BUSY)
+    {
+        return e_ERROR_UART_STREAM_BUSY;
+    }
+
+    streamBuffer = buffer;
+    streamProducer = producer;
+    streamProgress = progress;
+    streamContext = context;
+    streamStatus.sent = RESET;
+    streamStatus.total = length;
+    streamStatus.state = UART_STREAM_BUSY;
+
+    return SUCCESS;
+}
+
+/************************************************************************************************
+ * Function    : static bool UartStreamChunk(void)
+ *
+ * Summary     : Moves one chunk of the stream into the normal transmit lane.
+ *
+ * Returns     : true when a chunk was queued or the stream ended, false when the lane has
+ *               no room for a chunk on this pass.
+ ************************************************************************************************/
+static bool UartStreamChunk(void)
+{
+    uint32_t chunkMax = UART_STREAM_CHUNK;
+    uint32_t count;
+    char *chunk;
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    DRV_USART_TX_RING_STATUS ringStatus;
+#endif
+
+    if((streamProducer == NULL) && ((streamStatus.total - streamStatus.sent) < chunkMax))
+    {
+        chunkMax = streamStatus.total - streamStatus.sent;
+    }
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    /* The other half of the lane is left for log records */
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &ringStatus);
+    if((ringStatus.used + chunkMax) > (ringStatus.size / 2U))
+    {
+        return false;
+    }
+#endif
+
+    chunk = UartTxReserve((int)chunkMax);
+    if(chunk == NULL)
+    {
+        return false;
+    }
+
+    if(streamProducer != NULL)
+    {
+        count = streamProducer(chunk, chunkMax, streamContext);
+        if(count > chunkMax)
+        {
+            count = chunkMax;
+        }
+    }
+    else
+    {
+        memcpy(chunk, &streamBuffer[streamStatus.sent], chunkMax);
+        count = chunkMax;
+    }
+
+    if(count == ZERO)
+    {
+        /* End of a produced stream, give the room back */
+        (void)UartTxCommit(ZERO);
+        streamStatus.total = streamStatus.sent;
+        streamStatus.state = UART_STREAM_DONE;
+    }
+    else if(UartTxCommit((int)count) != SUCCESS)
+    {
+        streamStatus.state = UART_STREAM_ABORTED;
+    }
+    else
+    {
+        streamStatus.sent += count;
+        if((streamProducer == NULL) && (streamStatus.sent == streamStatus.total))
+        {
+            streamStatus.state = UART_STREAM_DONE;
+        }
+    }
+    return true;
+}
+
+
+/* Section: Interface Functions                                         */
+
+/************************************************************************************************
+ * Function    : int8_t UartStreamWrite(const char *buffer, uint32_t length,
+ *                                      UART_STREAM_PROGRESS progress, uintptr_t context)
+ *
+ * Remarks     : See prototype in HAL_UartStream.h.
+ ************************************************************************************************/
+int8_t UartStreamWrite(const char *buffer, uint32_t length, UART_STREAM_PROGRESS progress, uintptr_t context)
+{
+    if(buffer == NULL)
+    {
+        return e_ERROR_UART_INVALID_POINTER;
+    }
+    if(length == NO_DATA)
+    {
+        return e_NO_DATA;
+    }
+    return UartStreamStart(buffer, length, NULL, progress, context);
+}
+
+/************************************************************************************************
+ * Function    : int8_t UartStreamProduce(UART_STREAM_PRODUCER producer, UART_STREAM_PROGRESS progress,
+ *                                        uintptr_t context)
+ *
+ * Remarks     : See prototype in HAL_UartStream.h.
+ ************************************************************************************************/
+int8_t UartStreamProduce(UART_STREAM_PRODUCER producer, UART_STREAM_PROGRESS progress, uintptr_t context)
+{
+    if(producer == NULL)
+    {
+        return e_ERROR_UART_INVALID_POINTER;
+    }
+    return UartStreamStart(NULL, RESET, producer, progress, context);
+}
+
+/************************************************************************************************
+ * Function    : void UartStreamTasks(void)
+ *
+ * Remarks     : See prototype in HAL_UartStream.h.
+ ************************************************************************************************/
+void UartStreamTasks(void)
+{
+    uint32_t sentBefore = streamStatus.sent;
+    CORE_TIMER_TIMEOUT budget;
+
+    if(streamStatus.state != UART_STREAM_BUSY)
+    {
+        return;
+    }
+
+    CoreTimerTimeoutStart(&budget, UART_STREAM_BUDGET_US);
+
+    while(UartStreamChunk() && (streamStatus.state == UART_STREAM_BUSY))
+    {
+        if(CoreTimerTimeoutExpired(&budget))
+        {
+            break;
+        }
+    }
+
+    if((streamProgress != NULL) &&
+       ((streamStatus.sent != sentBefore) || (streamStatus.state != UART_STREAM_BUSY)))
+    {
+        /* May start the next stream */
+        streamProgress(&streamStatus, streamContext);
+    }
+}
+
+/************************************************************************************************
+ * Function    : void UartStreamStatusGet(UART_STREAM_STATUS *status)
+ *
+ * Remarks     : See prototype in HAL_UartStream.h.
+ ************************************************************************************************/
+void UartStreamStatusGet(UART_STREAM_STATUS *status)
+{
+    *status = streamStatus;
+}
+
+/************************************************************************************************
+ * Function    : void UartStreamAbort(void)
+ *
+ * Remarks     : See prototype in HAL_UartStream.h.
+ ************************************************************************************************/
+void UartStreamAbort(void)
+{
+    if(streamStatus.state == UART_STREAM_BUSY)
+    {
+        streamStatus.state = UART_STREAM_ABORTED;
+    }
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -70,6 +70,14 @@ void APP_Initialize(void)
 {
     /* Place the App state machine in its initial state. */
     appData.state = APP_STATE_INIT;
+
+#if (APP_LOG_PERSIST == true)
+    /* Log records from before the reset go out ahead of the banner */
+    if(AppLogPersistReplayPending())
+    {
+        appData.state = APP_STATE_LOG_REPLAY;
+    }
+#endif
 }
 
 /*******************************************************************************
@@ -81,9 +89,6 @@ void APP_Initialize(void)
  *******************************************************************************/
 void APP_Tasks(void)
 {
-    /* Buffer for debug UART printing */
-    char debugBuff[BUFFER_SIZE] = {ZERO};
-    
     /* Check the application's current state. */
     switch(appData.state)
     {
@@ -99,17 +104,17 @@ void APP_Tasks(void)
                 SystemInit();
 
                 // Print module banner and version info over debug UART
-                sprintf(debugBuff, "\r\n==========[ UART MODULE INFO ]==========\r\n");
-                AppDebugPrint(debugBuff);
+                AppDebugPrint("\r\n==========[ UART MODULE INFO ]==========\r\n");
 
-                sprintf(debugBuff, "   Firmware Version : %d.%d.%d\r\n",GetIMDFirmwareMajor(),GetIMDFirmwareMinor(),GetIMDFirmwarePatch());
-                AppDebugPrint(debugBuff);
+                AppDebugPrintf("   Firmware Version : %d.%d.%d\r\n",GetIMDFirmwareMajor(),GetIMDFirmwareMinor(),GetIMDFirmwarePatch());
 
-                sprintf(debugBuff, "   Module Name      : UART MODULE\r\n");
-                AppDebugPrint(debugBuff);
+                AppDebugPrint("   Module Name      : UART MODULE\r\n");
 
-                sprintf(debugBuff, "=========================================\r\n");
-                AppDebugPrint(debugBuff);
+                AppDebugPrint("=========================================\r\n");
+#if (APP_LOG_PROFILE == true)
+                /* Report what one log call costs at each level */
+                AppLogProfile();
+#endif
                 
                 /* Transition to next application state */
                 appData.state = APP_STATE_SERVICE_TASKS;
@@ -120,10 +125,38 @@ void APP_Tasks(void)
             /* Application's service task state */
         case APP_STATE_SERVICE_TASKS:
         {
-            sprintf(debugBuff, "Hello Uart!\r\n");
-            AppDebugPrint(debugBuff);
+            /* Printed on every pass, so limited to keep UART5 free for everything else */
+            APP_LOG_RATE_LIMITED(AppDebugPrint("Hello Uart!\r\n"));
+
+            /* Keep the 64-bit core timer extension current while the log is quiet */
+            (void)CoreTimerGet64();
+
+#if (APP_LOG_RATE_LIMIT == true)
+            /* Summaries of rate limited call sites that went quiet */
+            AppLogLimitTasks();
+#endif
+
+            /* Apply LOGMASK / LOGLEVEL commands received on the debug UART */
+            AppLogConsoleTasks();
+
+#if (APP_BAUD_LINK == true)
+            /* Rate switch requested with BAUD= and its trial timeout */
+            AppBaudLinkTasks();
+#endif
+            break;
+        }
+
+#if (APP_LOG_PERSIST == true)
+            /* Replay of the log kept across the reset */
+        case APP_STATE_LOG_REPLAY:
+        {
+            if(AppLogPersistReplayTasks())
+            {
+                appData.state = APP_STATE_INIT;
+            }
             break;
         }
+#endif
 
             /* The default state should never be executed. */
         default:
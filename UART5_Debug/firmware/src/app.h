@@ -47,7 +47,8 @@
 typedef enum
 {
     APP_STATE_INIT = 0,         /* Initial application state */
-    APP_STATE_SERVICE_TASKS     /* Main application loop */
+    APP_STATE_SERVICE_TASKS,    /* Main application loop */
+    APP_STATE_LOG_REPLAY        /* Replaying the log kept from before the reset */
 } APP_STATES;
 
 /* ************************************************************************** */
@@ -100,12 +100,118 @@ DRV_USART_ERROR DRV_USART0_ErrorGet(void);
 size_t DRV_USART0_Read( void * buffer,const size_t numbytes);
 size_t DRV_USART0_Write( void * buffer, const size_t numbytes);
 
+#if (DRV_USART_INTERRUPT_MODE == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Interrupt Configuration for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+/* The system configuration gives the priorities as plain numbers, these build
+   the matching SYS_INT levels and the ISR priority level token. */
+#define _DRV_USART_CONCAT_(a, b, c)                 a##b##c
+#define _DRV_USART_CONCAT(a, b, c)                  _DRV_USART_CONCAT_(a, b, c)
+
+#define DRV_USART_INT_PRIORITY_LEVEL_IDX0           _DRV_USART_CONCAT(INT_PRIORITY_LEVEL, DRV_USART_INT_PRIORITY_IDX0, )
+#define DRV_USART_INT_SUB_PRIORITY_LEVEL_IDX0       _DRV_USART_CONCAT(INT_SUBPRIORITY_LEVEL, DRV_USART_INT_SUB_PRIORITY_IDX0, )
+
+#if (DRV_USART_INT_SRS_IDX0 == true)
+#if (DRV_USART_INT_PRIORITY_IDX0 != 7)
+#error "The shadow register set is assigned to priority 7 (FSRSSEL = PRIORITY_7), set DRV_USART_INT_PRIORITY_IDX0 to 7"
+#endif
+/* No general purpose register save and restore in the prologue and epilogue */
+#define DRV_USART_ISR_IPL_IDX0                      IPL7SRS
+#else
+#define DRV_USART_ISR_IPL_IDX0                      _DRV_USART_CONCAT(IPL, DRV_USART_INT_PRIORITY_IDX0, AUTO)
+#endif
+
+#if (DRV_USART_ISR_PROFILE == true)
+void DRV_USART0_IsrProfileUpdate(uint32_t entryCount, uint32_t exitCount);
+void DRV_USART0_IsrProfileGet(DRV_USART_ISR_PROFILE_DATA * profile);
+#endif
+#endif
+
+#if (DRV_USART_STATISTICS == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Statistics Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+void DRV_USART0_StatsGet(DRV_USART_STATS * stats);
+#endif
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Buffer Queue Client Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+void DRV_USART0_BufferAddWrite(DRV_USART_BUFFER_HANDLE * bufferHandle, void * buffer, const size_t size);
+void DRV_USART0_BufferAddRead(DRV_USART_BUFFER_HANDLE * bufferHandle, void * buffer, const size_t size);
+void DRV_USART0_BufferAbortWrite(void);
+void DRV_USART0_BufferEventHandlerSet(const DRV_USART_BUFFER_EVENT_HANDLER eventHandler, const uintptr_t context);
+#endif
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Receive Ring Client Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+size_t DRV_USART0_RxRingCount(void);
+size_t DRV_USART0_RxRingPeek(const uint8_t ** data);
+void DRV_USART0_RxRingConsume(size_t nBytes);
+void DRV_USART0_RxRingEventHandlerSet(const DRV_USART_RX_RING_EVENT_HANDLER eventHandler, const uintptr_t context);
+void DRV_USART0_RxRingTasks(void);
+#endif
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Flow Control Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+void DRV_USART0_FlowControlTasks(void);
+#endif
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Transmit DMA Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+void DRV_USART0_TasksTransmitDma(void);
+#endif
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+// *********************************************************************************************
+// *********************************************************************************************
+// Section: Transmit Ring Client Interface Headers for the Instance 0 of USART static driver
+// *********************************************************************************************
+// *********************************************************************************************
+
+size_t DRV_USART0_TxRingWrite(const void * buffer, const size_t numbytes);
+size_t DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE lane, const void * buffer, const size_t numbytes);
+size_t DRV_USART0_TxLaneWriteV(DRV_USART_TX_LANE lane, const DRV_USART_SEGMENT * segments, const size_t count);
+void * DRV_USART0_TxLaneReserve(DRV_USART_TX_LANE lane, const size_t nBytes);
+size_t DRV_USART0_TxLaneCommit(DRV_USART_TX_LANE lane, const size_t nBytes);
+bool DRV_USART0_TxRingIsEmpty(void);
+void DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE lane, DRV_USART_TX_RING_STATUS * status);
+#endif
+
 // *********************************************************************************************
 // *********************************************************************************************
 // Section: Set up Client Interface Headers for the Instance 0 of USART static driver
 // *********************************************************************************************
 // *********************************************************************************************
 DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudSet(uint32_t baud);
+DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudCheck(uint32_t baud);
+void DRV_USART0_BaudStatusGet(DRV_USART_BAUD_STATUS * status);
 DRV_USART_LINE_CONTROL_SET_RESULT DRV_USART0_LineControlSet(DRV_USART_LINE_CONTROL lineControlMode);
 
 // DOM-IGNORE-BEGIN
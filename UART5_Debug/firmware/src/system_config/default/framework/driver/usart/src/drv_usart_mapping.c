@@ -320,6 +320,77 @@ size_t DRV_USART_Write(const DRV_HANDLE handle,void * buffer,const size_t numbyt
 
 
 
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+//Buffer Queue Model
+void DRV_USART_BufferAddWrite(const DRV_HANDLE handle, DRV_USART_BUFFER_HANDLE * bufferHandle, void * buffer, const size_t size)
+{
+    uintptr_t instance;
+
+    instance = handle & 0x00FF;
+    //As we are handling single client, only multiple instance is taken care.
+    switch(instance)
+    {
+        case DRV_USART_INDEX_0:
+        {
+            DRV_USART0_BufferAddWrite(bufferHandle, buffer, size);
+            break;
+        }
+        default:
+        {
+            if(bufferHandle != NULL)
+            {
+                *bufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+            }
+            break;
+        }
+    }
+}
+
+void DRV_USART_BufferAddRead(const DRV_HANDLE handle, DRV_USART_BUFFER_HANDLE * bufferHandle, void * buffer, const size_t size)
+{
+    uintptr_t instance;
+
+    instance = handle & 0x00FF;
+    //As we are handling single client, only multiple instance is taken care.
+    switch(instance)
+    {
+        case DRV_USART_INDEX_0:
+        {
+            DRV_USART0_BufferAddRead(bufferHandle, buffer, size);
+            break;
+        }
+        default:
+        {
+            if(bufferHandle != NULL)
+            {
+                *bufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+            }
+            break;
+        }
+    }
+}
+
+void DRV_USART_BufferEventHandlerSet(const DRV_HANDLE handle, const DRV_USART_BUFFER_EVENT_HANDLER eventHandler, const uintptr_t context)
+{
+    uintptr_t instance;
+
+    instance = handle & 0x00FF;
+    //As we are handling single client, only multiple instance is taken care.
+    switch(instance)
+    {
+        case DRV_USART_INDEX_0:
+        {
+            DRV_USART0_BufferEventHandlerSet(eventHandler, context);
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+}
+#endif
+
 DRV_USART_BAUD_SET_RESULT DRV_USART_BaudSet(const DRV_HANDLE handle, uint32_t baud)
 {
     uintptr_t instance;
@@ -53,9 +53,14 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 // *****************************************************************************
 // *****************************************************************************
 
+#include <string.h>
 #include "system_config.h"
 #include "system_definitions.h"
 
+#if (_DRV_USART_BAUD_ERROR_IDX0 > DRV_USART_BAUD_ERROR_MAX_IDX0)
+#error "DRV_USART_BAUD_RATE_IDX0 cannot be generated from SYS_CLK_BUS_PERIPHERAL_1 within DRV_USART_BAUD_ERROR_MAX_IDX0"
+#endif
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -66,6 +71,12 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 /* This is the driver static object . */
 DRV_USART_OBJ  gDrvUSART0Obj ;
 
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+/* Buffer queue slots, see drv_usart_static_buffer_queue.c */
+extern DRV_USART_BUFFER_OBJ gDrvUSART0WriteQueue[DRV_USART_XMIT_QUEUE_SIZE_IDX0];
+extern DRV_USART_BUFFER_OBJ gDrvUSART0ReadQueue[DRV_USART_RCV_QUEUE_SIZE_IDX0];
+#endif
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Instance 0 static driver functions
@@ -74,8 +85,6 @@ DRV_USART_OBJ  gDrvUSART0Obj ;
 
 SYS_MODULE_OBJ DRV_USART0_Initialize(void)
 {
-    uint32_t clockSource;
-
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
     dObj = &gDrvUSART0Obj;
 
@@ -84,14 +93,25 @@ SYS_MODULE_OBJ DRV_USART0_Initialize(void)
 
     /* Update the USART OBJECT parameters. */
     dObj->interruptNestingCount = 0;
-    dObj->queueSizeCurrentRead  = 0;
-    dObj->queueSizeCurrentWrite = 0;
-    dObj->queueRead             = NULL;
-    dObj->queueWrite            = NULL;
+    dObj->readQueue.head        = 0;
+    dObj->readQueue.tail        = 0;
+    dObj->writeQueue.head       = 0;
+    dObj->writeQueue.tail       = 0;
     dObj->eventHandler          = NULL;
     dObj->context               = (uintptr_t)NULL;
     dObj->error                 = DRV_USART_ERROR_NONE;
 
+#if (DRV_USART_STATISTICS == true)
+    memset(&dObj->stats, 0, sizeof(dObj->stats));
+#endif
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    _DRV_USART0_TxRingInitialize();
+#endif
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    _DRV_USART0_RxRingInitialize();
+#endif
+
     /* Initialize the USART based on configuration settings */
     PLIB_USART_InitializeModeGeneral(USART_ID_5,
             false,  /*Auto baud*/
@@ -103,20 +123,65 @@ SYS_MODULE_OBJ DRV_USART0_Initialize(void)
     /* Set the line control mode */
     PLIB_USART_LineControlModeSelect(USART_ID_5, DRV_USART_LINE_CONTROL_8NONE1);
 
-    /* We set the receive interrupt mode to receive an interrupt whenever FIFO
-       is not empty */
+    /* We set the receive interrupt mode to receive an interrupt at the
+       configured FIFO level, and the transmit interrupt mode to interrupt as soon as
+       the transmit FIFO is empty so a full burst can be written while the
+       last character is still shifting out. UART5 has no UxCTS and UxRTS
+       pins, DRV_USART_FLOW_CONTROL_IDX0 runs the handshake on port pins. */
     PLIB_USART_InitializeOperation(USART_ID_5,
-            USART_RECEIVE_FIFO_ONE_CHAR,
-            USART_TRANSMIT_FIFO_IDLE,
+            _DRV_USART_RX_FIFO_TRIGGER,
+            USART_TRANSMIT_FIFO_EMPTY,
             USART_ENABLE_TX_RX_USED);
 
-    /* Get the USART clock source value*/
-    clockSource = SYS_CLK_PeripheralFrequencyGet ( CLK_BUS_PERIPHERAL_1 );
+    /* Set the baud rate chosen at build time and enable the USART */
+    _DRV_USART0_BaudGeneratorSet(_DRV_USART_BRGH_IDX0, _DRV_USART_BRG_IDX0);
+    dObj->baud.requested       = DRV_USART_BAUD_RATE_IDX0;
+    dObj->baud.brgh            = _DRV_USART_BRGH_IDX0;
+    dObj->baud.brg             = _DRV_USART_BRG_IDX0;
+    dObj->baud.actual          = (uint32_t)_DRV_USART_BAUD(SYS_CLK_BUS_PERIPHERAL_1, _DRV_USART_BRG_IDX0,
+                                    (_DRV_USART_BRGH_IDX0 ? 4ull : 16ull));
+    dObj->baud.errorHundredths = (int32_t)(((int64_t)dObj->baud.actual - DRV_USART_BAUD_RATE_IDX0) * 10000
+                                    / DRV_USART_BAUD_RATE_IDX0);
+
+    PLIB_USART_Enable(USART_ID_5);
+    PLIB_USART_TransmitterEnable(USART_ID_5);
+    PLIB_USART_ReceiverEnable(USART_ID_5);
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    /* Tell the host it may send */
+    _DRV_USART0_FlowControlInitialize();
+#endif
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    /* Point the transmit channel at UxTXREG */
+    _DRV_USART0_TxDmaInitialize();
+#endif
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    /* Clear the interrupt flags */
+    SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_TRANSMIT);
+    SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_RECEIVE);
+    SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_ERROR);
 
-    /* Set the baud rate and enable the USART */
-    PLIB_USART_BaudSetAndEnable(USART_ID_5,
-            clockSource,
-            115200);  /*Desired Baud rate value*/
+    /* Enable the error interrupt source. The transmit source is enabled
+       only while data is pending. */
+    SYS_INT_SourceEnable(INT_SOURCE_USART_5_ERROR);
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    /* Received bytes always go to a queued read buffer or the receive ring */
+    SYS_INT_SourceEnable(INT_SOURCE_USART_5_RECEIVE);
+#endif
+
+#if (DRV_USART_ISR_PROFILE == true)
+    gDrvUSART0Obj.isrTriggerArmed = false;
+    gDrvUSART0Obj.isrProfile.count = 0;
+    gDrvUSART0Obj.isrProfile.latencyCount = 0;
+    gDrvUSART0Obj.isrProfile.latencyMin = UINT32_MAX;
+    gDrvUSART0Obj.isrProfile.latencyMax = 0;
+    gDrvUSART0Obj.isrProfile.bodyMin = UINT32_MAX;
+    gDrvUSART0Obj.isrProfile.bodyMax = 0;
+#endif
+#endif
 
     /* Return the driver instance value*/
     return (SYS_MODULE_OBJ)DRV_USART_INDEX_0;
@@ -146,6 +211,26 @@ void DRV_USART0_TasksTransmit(void)
     /* Reading the transmit interrupt flag */
     if(SYS_INT_SourceStatusGet(INT_SOURCE_USART_5_TRANSMIT))
     {
+        _DRV_USART_STATS_ADD(txInterrupts, 1);
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+        if(_DRV_USART0_TxStalled())
+        {
+            /* The host cannot take data, leave everything queued */
+            return;
+        }
+#endif
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+        if(gDrvUSART0Obj.txDmaActive)
+        {
+            /* A client enabled the source while the channel owns the FIFO,
+               DRV_USART0_TasksTransmitDma enables it again when done */
+            SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+            return;
+        }
+#endif
+
         /* The USART driver is configured to generate an
            interrupt when the FIFO is empty. Additionally
            the queue is not empty. Which means there is
@@ -154,6 +239,18 @@ void DRV_USART0_TasksTransmit(void)
 
         /* Clear up the interrupt flag */
         SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_TRANSMIT);
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+        /* Stop the transmit interrupt once there is nothing left to send */
+#if (DRV_USART_TX_RING_SUPPORT == true)
+        _DRV_USART0_TxRingInterruptUpdate();
+#else
+        if(_DRV_USART_QUEUE_IS_EMPTY(gDrvUSART0Obj.writeQueue))
+        {
+            SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+        }
+#endif
+#endif
     }
 }
 
@@ -166,10 +263,20 @@ void DRV_USART0_TasksReceive(void)
     /* Reading the receive interrupt flag */
     if(SYS_INT_SourceStatusGet(INT_SOURCE_USART_5_RECEIVE))
     {
+        _DRV_USART_STATS_ADD(rxInterrupts, 1);
+
         _DRV_USART0_BufferQueueRxTasks();
 
         /* Clear up the interrupt flag */
         SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_RECEIVE);
+
+#if (DRV_USART_INTERRUPT_MODE == true) && (DRV_USART_RX_RING_SUPPORT == false)
+        /* Hand the FIFO back to DRV_USART0_Read once no buffer is queued */
+        if(_DRV_USART_QUEUE_IS_EMPTY(gDrvUSART0Obj.readQueue))
+        {
+            SYS_INT_SourceDisable(INT_SOURCE_USART_5_RECEIVE);
+        }
+#endif
     }
 }
 
@@ -183,6 +290,8 @@ void DRV_USART0_TasksError(void)
     /* Reading the error interrupt flag */
     if(SYS_INT_SourceStatusGet(INT_SOURCE_USART_5_ERROR))
     {
+        _DRV_USART_STATS_ADD(errorInterrupts, 1);
+
         /* This means an error has occurred */
         _DRV_USART0_BufferQueueErrorTasks();
         /* Clear up the error interrupt flag */
@@ -249,6 +358,75 @@ DRV_USART_ERROR DRV_USART0_ErrorGet(void)
     return(error);
 }
 
+#if (DRV_USART_STATISTICS == true)
+void DRV_USART0_StatsGet(DRV_USART_STATS * stats)
+{
+    bool interruptState;
+
+    if(stats == NULL)
+    {
+        return;
+    }
+
+    /* Take a consistent copy, the tasks routines update the counters
+       from the interrupt */
+    interruptState = SYS_INT_Disable();
+    *stats = gDrvUSART0Obj.stats;
+    SYS_INT_Restore(interruptState);
+}
+#endif
+
+#if (DRV_USART_INTERRUPT_MODE == true) && (DRV_USART_ISR_PROFILE == true)
+void DRV_USART0_IsrProfileUpdate(uint32_t entryCount, uint32_t exitCount)
+{
+    DRV_USART_ISR_PROFILE_DATA *profile = &gDrvUSART0Obj.isrProfile;
+    uint32_t ticks;
+
+    /* The first interrupt after the transmit source was enabled measures
+       the latency, later ones are flag driven and have no reference */
+    if(gDrvUSART0Obj.isrTriggerArmed)
+    {
+        gDrvUSART0Obj.isrTriggerArmed = false;
+        ticks = entryCount - gDrvUSART0Obj.isrTriggerCount;
+        profile->latencyCount++;
+        if(ticks < profile->latencyMin)
+        {
+            profile->latencyMin = ticks;
+        }
+        if(ticks > profile->latencyMax)
+        {
+            profile->latencyMax = ticks;
+        }
+    }
+
+    ticks = exitCount - entryCount;
+    profile->count++;
+    if(ticks < profile->bodyMin)
+    {
+        profile->bodyMin = ticks;
+    }
+    if(ticks > profile->bodyMax)
+    {
+        profile->bodyMax = ticks;
+    }
+}
+
+void DRV_USART0_IsrProfileGet(DRV_USART_ISR_PROFILE_DATA * profile)
+{
+    bool interruptState;
+
+    if(profile == NULL)
+    {
+        return;
+    }
+
+    /* Take a consistent copy, the ISR updates several fields */
+    interruptState = SYS_INT_Disable();
+    *profile = gDrvUSART0Obj.isrProfile;
+    SYS_INT_Restore(interruptState);
+}
+#endif
+
 
 // *****************************************************************************
 // *****************************************************************************
@@ -258,20 +436,24 @@ DRV_USART_ERROR DRV_USART0_ErrorGet(void)
 
 void _DRV_USART0_BufferQueueRxTasks(void)
 {
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
     DRV_USART_BUFFER_OBJ * bufferObj;
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
+    uint8_t tail;
 
     dObj = &gDrvUSART0Obj;
 
     /* In this function, the driver checks if there are any buffers in queue. If
        so the buffer is serviced. A buffer that is serviced completely is
-       removed from the queue. Start by getting the buffer at the head of the
+       removed from the queue. Start by getting the buffer at the tail of the
        queue */
 
-    bufferObj = dObj->queueRead;
+    tail = dObj->readQueue.tail;
 
-    if(bufferObj != NULL)
+    if(tail != dObj->readQueue.head)
     {
+        bufferObj = &gDrvUSART0ReadQueue[tail & (DRV_USART_RCV_QUEUE_SIZE_IDX0 - 1)];
+
         /* The USART driver is configured to generate an interrupt when the FIFO
            is not empty. Additionally the queue is not empty. Which means there
            is work to done in this routine. Read data from the FIFO until either
@@ -283,6 +465,7 @@ void _DRV_USART0_BufferQueueRxTasks(void)
         {
             bufferObj->buffer[bufferObj->nCurrentBytes] = PLIB_USART_ReceiverByteReceive(USART_ID_5);
             bufferObj->nCurrentBytes ++;
+            _DRV_USART_STATS_ADD(rxBytes, 1);
         }
 
         /* Check if this buffer is done */
@@ -293,7 +476,7 @@ void _DRV_USART0_BufferQueueRxTasks(void)
                is a callback registered with client, then
                call it */
 
-            if((dObj->eventHandler != NULL) && (bufferObj->flags & DRV_USART_BUFFER_OBJ_FLAG_BUFFER_ADD))
+            if(dObj->eventHandler != NULL)
             {
                 /* Call the event handler. We additionally increment the
                    interrupt nesting count which lets the driver functions
@@ -310,40 +493,46 @@ void _DRV_USART0_BufferQueueRxTasks(void)
                 dObj->interruptNestingCount --;
             }
 
-            /* Get the next buffer in the queue and deallocate
-               this buffer */
-
-            dObj->queueRead = bufferObj->next;
-            bufferObj->inUse = false;
-            dObj->queueSizeCurrentRead --;
-
-            /* Reset the next and previous pointers */
-            bufferObj->next = NULL;
-            bufferObj->previous = NULL;
-
-            /* Reset the current head's previous pointer */
-            if (dObj->queueRead != NULL)
-            {
-                dObj->queueRead->previous = NULL;
-            }
-
+            /* Hand the slot back to the client */
+            _DRV_USART_MEMORY_BARRIER();
+            dObj->readQueue.tail = tail + 1;
         }
     }
-
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    else
+    {
+        /* No read buffer is queued, keep the data in the receive ring */
+        _DRV_USART0_RxRingReceive();
+    }
+#endif
+#elif (DRV_USART_RX_RING_SUPPORT == true)
+    /* Move the received data to the receive ring */
+    _DRV_USART0_RxRingReceive();
+#endif
 }
 
 void _DRV_USART0_BufferQueueTxTasks(void)
 {
-    /* Start by getting the buffer at the head of queue. */
-
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
     DRV_USART_BUFFER_OBJ * bufferObj;
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == false)
+    const uint8_t * data;
+    size_t nCurrentBytes;
+    size_t burst;
+#endif
+    uint8_t tail;
 
     dObj = &gDrvUSART0Obj;
-    bufferObj = dObj->queueWrite;
 
-    if(bufferObj != NULL)
+    /* Start by getting the buffer at the tail of queue. */
+
+    tail = dObj->writeQueue.tail;
+
+    if(tail != dObj->writeQueue.head)
     {
+        bufferObj = &gDrvUSART0WriteQueue[tail & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+
         /* This means the queue is not empty. Check if this buffer is done */
         if(bufferObj->nCurrentBytes >= bufferObj->size)
         {
@@ -351,13 +540,12 @@ void _DRV_USART0_BufferQueueTxTasks(void)
                is a callback registered with client, then
                call it */
 
-            if((dObj->eventHandler != NULL) && (bufferObj->flags & DRV_USART_BUFFER_OBJ_FLAG_BUFFER_ADD))
+            if(dObj->eventHandler != NULL)
             {
                 /* Before calling the event handler, the interrupt nesting
                    counter is incremented. This will allow driver routine that
                    are called from the event handler to know the interrupt
-                   nesting level. Events are only generated for buffers that
-                   were submitted using the buffer add routine */
+                   nesting level. */
 
                 dObj->interruptNestingCount ++;
 
@@ -369,50 +557,69 @@ void _DRV_USART0_BufferQueueTxTasks(void)
                 dObj->interruptNestingCount -- ;
             }
 
-            /* Get the next buffer in the queue and deallocate
-             * this buffer */
-
-            dObj->queueWrite = bufferObj->next;
-            bufferObj->inUse = false;
-            dObj->queueSizeCurrentWrite --;
-
-            /* Reset the next and previous pointers */
-            bufferObj->next = NULL;
-            bufferObj->previous = NULL;
-
-            /* Reset the current head's previous pointer */
-            if (dObj->queueWrite != NULL)
-            {
-                dObj->queueWrite->previous = NULL;
-            }
-
+            /* Hand the slot back to the client and move on to the
+               next buffer */
+            _DRV_USART_MEMORY_BARRIER();
+            tail ++;
+            dObj->writeQueue.tail = tail;
         }
     }
 
     /* Check if the queue is still not empty and process
        the buffer */
 
-    if(dObj->queueWrite != NULL)
+    if((tail != dObj->writeQueue.head)
+#if (DRV_USART_TX_RING_SUPPORT == true)
+            /* A ring record already on the wire is finished first */
+            && (dObj->txRecordRemaining == 0)
+#endif
+      )
     {
-        bufferObj = dObj->queueWrite;
+        bufferObj = &gDrvUSART0WriteQueue[tail & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+        /* Hand the whole buffer to the DMA channel */
+        _DRV_USART0_TxDmaStart(bufferObj);
+#else
+        /* The transmit flag is only set with an empty FIFO. Write one
+           FIFO worth of data without polling the buffer full flag */
+        nCurrentBytes = bufferObj->nCurrentBytes;
+        burst = bufferObj->size - nCurrentBytes;
+        if(burst > _DRV_USART_TX_DEPTH)
+        {
+            burst = _DRV_USART_TX_DEPTH;
+        }
+        data = &bufferObj->buffer[nCurrentBytes];
+        bufferObj->nCurrentBytes = nCurrentBytes + burst;
+        _DRV_USART_STATS_ADD(txBytes, burst);
 
-        /* Fill up the FIFO with data until the FIFO is full
-           and we have data to send */
-        while((!PLIB_USART_TransmitterBufferIsFull(USART_ID_5))
-                && (bufferObj->nCurrentBytes < bufferObj->size ))
+        while(burst != 0)
         {
-            PLIB_USART_TransmitterByteSend(USART_ID_5, bufferObj->buffer[bufferObj->nCurrentBytes]);
-            bufferObj->nCurrentBytes ++;
+            PLIB_USART_TransmitterByteSend(USART_ID_5, *data++);
+            burst --;
         }
+#endif
     }
-
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    else
+    {
+        /* No queued buffer is in flight. Feed the FIFO from the
+           transmit ring, queued buffers go first between records. */
+        _DRV_USART0_TxRingTasks(_DRV_USART_TX_DEPTH);
+    }
+#endif
+#elif (DRV_USART_TX_RING_SUPPORT == true)
+    /* Feed the empty FIFO from the transmit ring */
+    _DRV_USART0_TxRingTasks(_DRV_USART_TX_DEPTH);
+#endif
 }
 
 void _DRV_USART0_BufferQueueErrorTasks(void)
 {
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
     DRV_USART_BUFFER_OBJ * bufferObj;
-    bool mutexGrabbed  = true;
+    uint8_t tail;
 
     dObj = &gDrvUSART0Obj;
 
@@ -420,57 +627,112 @@ void _DRV_USART0_BufferQueueErrorTasks(void)
      * going to occur at any time based on checks before write.
      * So, only RX errors are to be handled/reported */
 
-    /* Get the RX buffer at the head */
-    bufferObj = dObj->queueRead;
+    /* Get the RX buffer at the tail */
+    tail = dObj->readQueue.tail;
 
-    /* mutexGrabbed will always be true for non-RTOS case.
-     * Will be false when mutex aquisition timed out in RTOS mode */
-    if(true == mutexGrabbed)
+    if(tail != dObj->readQueue.head)
     {
-        if(bufferObj != NULL)
+        bufferObj = &gDrvUSART0ReadQueue[tail & (DRV_USART_RCV_QUEUE_SIZE_IDX0 - 1)];
+
+        /* Get the USART errors */
+        dObj->error = PLIB_USART_ErrorsGet(USART_ID_5);
+
+        /* Clear error condition */
+        _DRV_USART0_ErrorConditionClear();
+
+        /* Call event handler with buffer event error state. A
+         * DRV_USART_Read call reports the error through its own result */
+        if(dObj->eventHandler != NULL)
         {
-            /* Get the USART errors */
-            dObj->error = PLIB_USART_ErrorsGet(USART_ID_5);
+            dObj->interruptNestingCount ++;
 
-	        /* Clear error condition */
-            _DRV_USART0_ErrorConditionClear();
+            dObj->eventHandler(DRV_USART_BUFFER_EVENT_ERROR,
+                    bufferObj->bufferHandle,
+                    dObj->context);
 
-            /* Call event handler in Buffer queue request only.
-             * If it's a File i/o request then DRV_USART_Read call itself
-             * will return with error result */
-            if((dObj->eventHandler != NULL) && (bufferObj->flags & DRV_USART_BUFFER_OBJ_FLAG_BUFFER_ADD))
-            {
-                /* Call the event handler with buffer event error state */
-                dObj->eventHandler(DRV_USART_BUFFER_EVENT_ERROR,
-                        bufferObj->bufferHandle,
-                        dObj->context);
-            }
+            dObj->interruptNestingCount --;
+        }
 
-            /* Get the next buffer in the queue and deallocate
-             * this buffer */
+        /* Drop the failed buffer from the queue */
+        _DRV_USART_MEMORY_BARRIER();
+        dObj->readQueue.tail = tail + 1;
+        return;
+    }
+#endif
 
-            dObj->queueRead = bufferObj->next;
-            bufferObj->inUse = false;
-            dObj->queueSizeCurrentRead --;
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    /* The receive ring is the reader, DRV_USART0_Read reports the error */
+    gDrvUSART0Obj.error = PLIB_USART_ErrorsGet(USART_ID_5);
+#endif
 
-            /* Reset the next and previous pointers */
-            bufferObj->next = NULL;
-            bufferObj->previous = NULL;
+    /* There is no buffer in the queue.
+     * Flush the RX to clear the error condition */
+    _DRV_USART0_ErrorConditionClear();
+}
 
-            /* If queue head is not null, update buffer pointer parameters*/
-            if (dObj->queueRead != NULL)
-            {
-                /* Reset the updated head's previous pointer */
-                dObj->queueRead->previous = NULL;
-            }
-        }
-        else
-        {
-            /* There is no buffer in the queue.
-             * Flush the RX to clear the error condition */
-            _DRV_USART0_ErrorConditionClear();
-        }
+static bool _DRV_USART0_BaudCompute(uint32_t clock, uint32_t baud, DRV_USART_BAUD_STATUS * status)
+{
+    uint64_t brgLow;
+    uint64_t brgHigh;
+    uint32_t errorLow = UINT32_MAX;
+    uint32_t errorHigh = UINT32_MAX;
+    uint32_t actual;
+
+    if(baud == 0)
+    {
+        return false;
+    }
+
+    /* Same selection as the build time one, see _DRV_USART_BRG */
+    brgLow = _DRV_USART_BRG((uint64_t)clock, (uint64_t)baud, 16ull);
+    brgHigh = _DRV_USART_BRG((uint64_t)clock, (uint64_t)baud, 4ull);
+
+    if(brgLow <= _DRV_USART_BRG_MAX)
+    {
+        errorLow = _DRV_USART_BAUD_ERROR(_DRV_USART_BAUD((uint64_t)clock, brgLow, 16ull), (uint64_t)baud);
+    }
+    if(brgHigh <= _DRV_USART_BRG_MAX)
+    {
+        errorHigh = _DRV_USART_BAUD_ERROR(_DRV_USART_BAUD((uint64_t)clock, brgHigh, 4ull), (uint64_t)baud);
+    }
+
+    if(errorLow <= errorHigh)
+    {
+        status->brgh = false;
+        status->brg = (uint16_t)brgLow;
+        actual = (uint32_t)_DRV_USART_BAUD((uint64_t)clock, brgLow, 16ull);
+    }
+    else
+    {
+        status->brgh = true;
+        status->brg = (uint16_t)brgHigh;
+        actual = (uint32_t)_DRV_USART_BAUD((uint64_t)clock, brgHigh, 4ull);
+    }
+
+    if(((errorLow < errorHigh) ? errorLow : errorHigh) > DRV_USART_BAUD_ERROR_MAX_IDX0)
+    {
+        return false;
+    }
+
+    status->requested = baud;
+    status->actual = actual;
+    status->errorHundredths = (int32_t)(((int64_t)actual - (int64_t)baud) * 10000 / (int64_t)baud);
+    return true;
+}
+
+void _DRV_USART0_BaudGeneratorSet(bool brgh, uint16_t brg)
+{
+    /* The peripheral library only computes the divisor by truncation, the
+       rounded one is written to the register directly */
+    if(brgh)
+    {
+        PLIB_USART_BaudRateHighEnable(USART_ID_5);
+    }
+    else
+    {
+        PLIB_USART_BaudRateHighDisable(USART_ID_5);
     }
+    U5BRG = brg;
 }
 
 void _DRV_USART0_ErrorConditionClear()
@@ -478,9 +740,25 @@ void _DRV_USART0_ErrorConditionClear()
     uint8_t dummyData = 0u;
     /* RX length = (FIFO level + RX register) */
     uint8_t RXlength = _DRV_USART_RX_DEPTH;
+    USART_ERROR errors = PLIB_USART_ErrorsGet(USART_ID_5);
+
+#if (DRV_USART_STATISTICS == true)
+    if(errors & USART_ERROR_RECEIVER_OVERRUN)
+    {
+        _DRV_USART_STATS_ADD(overrunErrors, 1);
+    }
+    if(errors & USART_ERROR_FRAMING)
+    {
+        _DRV_USART_STATS_ADD(framingErrors, 1);
+    }
+    if(errors & USART_ERROR_PARITY)
+    {
+        _DRV_USART_STATS_ADD(parityErrors, 1);
+    }
+#endif
 
     /* If it's a overrun error then clear it to flush FIFO */
-    if(USART_ERROR_RECEIVER_OVERRUN & PLIB_USART_ErrorsGet(USART_ID_5))
+    if(USART_ERROR_RECEIVER_OVERRUN & errors)
     {
         PLIB_USART_ReceiverOverrunErrorClear(USART_ID_5);
     }
@@ -490,6 +768,7 @@ void _DRV_USART0_ErrorConditionClear()
     {
         dummyData = PLIB_USART_ReceiverByteReceive(USART_ID_5);
         RXlength--;
+        _DRV_USART_STATS_ADD(flushedBytes, 1);
 
         /* Try to flush error bytes for one full FIFO and exit instead of
          * blocking here if more error bytes are received*/
@@ -514,58 +793,125 @@ void _DRV_USART0_ErrorConditionClear()
 
 DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudSet(uint32_t baud)
 {
-    uint32_t clockSource;
-    int32_t brgValueLow=0;
-    int32_t brgValueHigh=0;
-    DRV_USART_BAUD_SET_RESULT retVal = DRV_USART_BAUD_SET_SUCCESS;
-#if defined (PLIB_USART_ExistsModuleBusyStatus)
-    bool isEnabled = false;
+    DRV_USART_BAUD_STATUS baudStatus;
+    CORE_TIMER_TIMEOUT timeout;
+    bool timedOut = false;
+    bool interruptWasEnabled;
+#if (DRV_USART_INTERRUPT_MODE == true)
+    bool txSourceWasEnabled;
 #endif
 
-    /* Get the USART clock source value*/
-    clockSource = SYS_CLK_PeripheralFrequencyGet ( CLK_BUS_PERIPHERAL_1 );
+    if(!_DRV_USART0_BaudCompute(SYS_CLK_PeripheralFrequencyGet(CLK_BUS_PERIPHERAL_1), baud, &baudStatus))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: Baud rate cannot be generated");
+        return DRV_USART_BAUD_SET_ERROR;
+    }
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    /* Keep the transmit tasks routine from loading the FIFO. Data still in
+       the rings and the write queue stays there and leaves at the new rate. */
+    txSourceWasEnabled = SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+#endif
 
-    /* Calculate low and high baud values */
-    brgValueLow  = ( (clockSource/baud) >> 4 ) - 1;
-    brgValueHigh = ( (clockSource/baud) >> 2 ) - 1;
+    CoreTimerTimeoutStart(&timeout, DRV_USART_BAUD_SET_TIMEOUT_US_IDX0);
 
-#if defined (PLIB_USART_ExistsModuleBusyStatus)
-        isEnabled = PLIB_USART_ModuleIsBusy (USART_ID_5);
-        if (isEnabled)
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    /* A buffer on the DMA channel finishes at the old rate. The channel
+       unmasks the source when it is done, which may start the next buffer
+       before the source is masked again. */
+    while(gDrvUSART0Obj.txDmaActive && !timedOut)
+    {
+        while(gDrvUSART0Obj.txDmaActive && !timedOut)
         {
-            PLIB_USART_Disable (USART_ID_5);
-            while (PLIB_USART_ModuleIsBusy (USART_ID_5));
+            timedOut = CoreTimerTimeoutExpired(&timeout);
         }
+        txSourceWasEnabled |= SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+    }
 #endif
 
-    /* Check if the baud value can be set with high baud settings */
-    if ((brgValueHigh >= 0) && (brgValueHigh <= UINT16_MAX))
+    /* Let the FIFO and the shift register empty at the old rate */
+    while(!timedOut && !PLIB_USART_TransmitterIsEmpty(USART_ID_5))
     {
-        PLIB_USART_BaudRateHighEnable(USART_ID_5);
-        PLIB_USART_BaudRateHighSet(USART_ID_5,clockSource,baud);
+        timedOut = CoreTimerTimeoutExpired(&timeout);
     }
 
-    /* Check if the baud value can be set with low baud settings */
-    else if ((brgValueLow >= 0) && (brgValueLow <= UINT16_MAX))
+    if(timedOut)
     {
-        PLIB_USART_BaudRateHighDisable(USART_ID_5);
-        PLIB_USART_BaudRateSet(USART_ID_5, clockSource, baud);
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: Transmitter busy, baud rate not changed");
+#if (DRV_USART_INTERRUPT_MODE == true)
+        /* A channel still running unmasks the source itself when it is done */
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+        if(txSourceWasEnabled && !gDrvUSART0Obj.txDmaActive)
+#else
+        if(txSourceWasEnabled)
+#endif
+        {
+            _DRV_USART_TX_SOURCE_ENABLE();
+        }
+#endif
+        return DRV_USART_BAUD_SET_TIMEOUT;
     }
-    else
+
+    interruptWasEnabled = SYS_INT_Disable();
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true) || (DRV_USART_RX_RING_SUPPORT == true)
+    /* Disabling the module resets the receive FIFO, move the bytes already
+       received to the read queue or the receive ring first */
+    if(PLIB_USART_ReceiverDataIsAvailable(USART_ID_5))
     {
-            retVal = DRV_USART_BAUD_SET_ERROR;
+        _DRV_USART0_BufferQueueRxTasks();
     }
+#endif
 
+    PLIB_USART_Disable(USART_ID_5);
 #if defined (PLIB_USART_ExistsModuleBusyStatus)
-    if (isEnabled)
+    while (PLIB_USART_ModuleIsBusy (USART_ID_5));
+#endif
+
+    _DRV_USART0_BaudGeneratorSet(baudStatus.brgh, baudStatus.brg);
+    PLIB_USART_Enable(USART_ID_5);
+    gDrvUSART0Obj.baud = baudStatus;
+
+    SYS_INT_Restore(interruptWasEnabled);
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    if(txSourceWasEnabled)
     {
-        PLIB_USART_Enable (USART_ID_5);
+        /* The transmit FIFO is empty, so the transmit tasks routine runs
+           right away and resumes the pending data */
+        _DRV_USART_TX_SOURCE_ENABLE();
     }
 #endif
 
-    return retVal;
+    return DRV_USART_BAUD_SET_SUCCESS;
 }
 
+DRV_USART_BAUD_SET_RESULT DRV_USART0_BaudCheck(uint32_t baud)
+{
+    DRV_USART_BAUD_STATUS baudStatus;
+
+    /* Same limits as DRV_USART0_BaudSet, the module is not touched */
+    if(!_DRV_USART0_BaudCompute(SYS_CLK_PeripheralFrequencyGet(CLK_BUS_PERIPHERAL_1), baud, &baudStatus))
+    {
+        return DRV_USART_BAUD_SET_ERROR;
+    }
+
+    return DRV_USART_BAUD_SET_SUCCESS;
+}
+
+void DRV_USART0_BaudStatusGet(DRV_USART_BAUD_STATUS * status)
+{
+    bool interruptState;
+
+    if(status == NULL)
+    {
+        return;
+    }
+
+    interruptState = SYS_INT_Disable();
+    *status = gDrvUSART0Obj.baud;
+    SYS_INT_Restore(interruptState);
+}
 
 DRV_USART_LINE_CONTROL_SET_RESULT DRV_USART0_LineControlSet(DRV_USART_LINE_CONTROL lineControlMode)
 {
@@ -0,0 +1,244 @@
+/*******************************************************************************
+  USART driver static implementation of the buffer queue model.
+
+  Company:
+    BTC POWER.
+
+  File Name:
+    drv_usart_static_buffer_queue.c
+
+  Summary:
+    Source code for the USART driver static buffer queue client interface.
+
+  Description:
+    This file contains the buffer add routines of the USART driver. A client
+    queues its own read or write buffer and returns immediately; the receive
+    and transmit tasks routines move the data directly between the buffer and
+    the hardware FIFO and report completion through the event handler
+    registered with DRV_USART0_BufferEventHandlerSet.
+
+  Remarks:
+    Each queue is a power of two array of buffer descriptors with a head
+    index written only by the client and a tail index written only by the
+    tasks routines. Adding and completing buffers therefore never disables
+    interrupts. All buffers of one queue must be added from the same
+    context: either task code, or the event handler when it runs inside the
+    tasks routines. DRV_USART0_BufferAbortWrite is the one client call that
+    moves the write tail, it does so with interrupts disabled.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "system_config.h"
+#include "system_definitions.h"
+
+#if (DRV_USART_BUFFER_QUEUE_SUPPORT == true)
+
+#if (DRV_USART_XMIT_QUEUE_SIZE_IDX0 > 128) || ((DRV_USART_XMIT_QUEUE_SIZE_IDX0 & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)) != 0)
+#error "DRV_USART_XMIT_QUEUE_SIZE_IDX0 must be a power of two up to 128"
+#endif
+
+#if (DRV_USART_RCV_QUEUE_SIZE_IDX0 > 128) || ((DRV_USART_RCV_QUEUE_SIZE_IDX0 & (DRV_USART_RCV_QUEUE_SIZE_IDX0 - 1)) != 0)
+#error "DRV_USART_RCV_QUEUE_SIZE_IDX0 must be a power of two up to 128"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+extern DRV_USART_OBJ  gDrvUSART0Obj ;
+
+/* Queue slots, served by the tasks routines in drv_usart_static.c */
+DRV_USART_BUFFER_OBJ gDrvUSART0WriteQueue[DRV_USART_XMIT_QUEUE_SIZE_IDX0];
+DRV_USART_BUFFER_OBJ gDrvUSART0ReadQueue[DRV_USART_RCV_QUEUE_SIZE_IDX0];
+
+/* Token used to build unique buffer handles */
+static uint16_t gDrvUSART0BufferToken = 0;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local functions
+// *****************************************************************************
+// *****************************************************************************
+
+static DRV_USART_BUFFER_HANDLE _DRV_USART0_BufferAdd
+(
+    DRV_USART_BUFFER_QUEUE * queue,
+    DRV_USART_BUFFER_OBJ * slots,
+    uint8_t queueSize,
+    void * buffer,
+    const size_t size
+)
+{
+    DRV_USART_BUFFER_OBJ * bufferObj;
+    DRV_USART_BUFFER_HANDLE bufferHandle;
+    uint8_t head = queue->head;
+
+    if((uint8_t)(head - queue->tail) >= queueSize)
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: Buffer queue is full");
+        return DRV_USART_BUFFER_HANDLE_INVALID;
+    }
+
+    bufferHandle = _DRV_USART_MAKE_HANDLE(gDrvUSART0BufferToken, (DRV_USART_BUFFER_HANDLE)head);
+    _DRV_USART_UPDATE_BUFFER_TOKEN(gDrvUSART0BufferToken);
+
+    bufferObj = &slots[head & (queueSize - 1)];
+    bufferObj->buffer        = (uint8_t *)buffer;
+    bufferObj->size          = size;
+    bufferObj->nCurrentBytes = 0;
+    bufferObj->bufferHandle  = bufferHandle;
+
+    /* Publish the slot only after it is complete */
+    _DRV_USART_MEMORY_BARRIER();
+    queue->head = head + 1;
+
+    return bufferHandle;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Instance 0 static driver functions
+// *****************************************************************************
+// *****************************************************************************
+
+void DRV_USART0_BufferAddWrite(DRV_USART_BUFFER_HANDLE * bufferHandle, void * source, const size_t nBytes)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+
+    if(bufferHandle == NULL)
+    {
+        return;
+    }
+
+    *bufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+
+    if((source == NULL) || (nBytes == 0))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: NULL data pointer or no data to write");
+        return;
+    }
+
+    *bufferHandle = _DRV_USART0_BufferAdd(&dObj->writeQueue, gDrvUSART0WriteQueue,
+            DRV_USART_XMIT_QUEUE_SIZE_IDX0, source, nBytes);
+    _DRV_USART_STATS_MAX(writeQueueHighWater, (uint32_t)_DRV_USART_QUEUE_COUNT(dObj->writeQueue));
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    if(*bufferHandle != DRV_USART_BUFFER_HANDLE_INVALID)
+    {
+        /* The transmit flag is set while the transmitter is idle, so the
+           transmit tasks routine starts on the buffer right away */
+        _DRV_USART_TX_SOURCE_ENABLE();
+    }
+#endif
+}
+
+void DRV_USART0_BufferAddRead(DRV_USART_BUFFER_HANDLE * bufferHandle, void * destination, const size_t nBytes)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+
+    if(bufferHandle == NULL)
+    {
+        return;
+    }
+
+    *bufferHandle = DRV_USART_BUFFER_HANDLE_INVALID;
+
+    if((destination == NULL) || (nBytes == 0))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: NULL data pointer or no data to read");
+        return;
+    }
+
+    *bufferHandle = _DRV_USART0_BufferAdd(&dObj->readQueue, gDrvUSART0ReadQueue,
+            DRV_USART_RCV_QUEUE_SIZE_IDX0, destination, nBytes);
+    _DRV_USART_STATS_MAX(readQueueHighWater, (uint32_t)_DRV_USART_QUEUE_COUNT(dObj->readQueue));
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    if(*bufferHandle != DRV_USART_BUFFER_HANDLE_INVALID)
+    {
+        /* Received bytes go straight into the buffer until the read queue
+           is empty again */
+        SYS_INT_SourceEnable(INT_SOURCE_USART_5_RECEIVE);
+    }
+#endif
+}
+
+void DRV_USART0_BufferAbortWrite(void)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+    DRV_USART_BUFFER_OBJ * bufferObj;
+    bool interruptWasEnabled;
+    uint8_t tail;
+    uint8_t head;
+
+    /* The transmit and the DMA vectors both move the tail */
+    interruptWasEnabled = SYS_INT_Disable();
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    if(dObj->txDmaActive)
+    {
+        /* The channel finishes the cell in flight and stops reading the
+           buffer, bytes already in the FIFO still leave */
+        PLIB_DMA_ChannelXDisable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0);
+        while(PLIB_DMA_ChannelXBusyIsBusy(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0));
+
+        PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_BLOCK_TRANSFER_COMPLETE);
+        SYS_INT_SourceStatusClear(DRV_USART_XMIT_DMA_INT_SRC_IDX0);
+        dObj->txDmaActive = false;
+    }
+#endif
+
+    /* Buffers the event handler adds from here on are kept */
+    head = dObj->writeQueue.head;
+
+    for(tail = dObj->writeQueue.tail; tail != head; tail ++)
+    {
+        bufferObj = &gDrvUSART0WriteQueue[tail & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+
+        if(dObj->eventHandler != NULL)
+        {
+            dObj->interruptNestingCount ++;
+
+            dObj->eventHandler(DRV_USART_BUFFER_EVENT_ERROR,
+                    bufferObj->bufferHandle,
+                    dObj->context);
+
+            dObj->interruptNestingCount -- ;
+        }
+
+        _DRV_USART_MEMORY_BARRIER();
+        dObj->writeQueue.tail = tail + 1;
+    }
+
+    SYS_INT_Restore(interruptWasEnabled);
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    /* The transmit rings and any buffer added by the event handler carry
+       on once the FIFO is empty */
+    _DRV_USART_TX_SOURCE_ENABLE();
+#endif
+}
+
+void DRV_USART0_BufferEventHandlerSet(const DRV_USART_BUFFER_EVENT_HANDLER eventHandler, const uintptr_t context)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+    bool interruptWasEnabled;
+
+    /* The tasks routines read both fields, update them together */
+    interruptWasEnabled = SYS_INT_Disable();
+    dObj->eventHandler = eventHandler;
+    dObj->context = context;
+    SYS_INT_Restore(interruptWasEnabled);
+}
+
+#endif /* DRV_USART_BUFFER_QUEUE_SUPPORT */
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,200 @@
+/*******************************************************************************
+  USART driver static implementation of the DMA transmit path.
+
+  Company:
+    BTC POWER.
+
+  File Name:
+    drv_usart_static_dma.c
+
+  Summary:
+    Source code for the USART driver static DMA transmit path.
+
+  Description:
+    With DRV_USART_SUPPORT_TRANSMIT_DMA a buffer of the write queue is not
+    copied into the transmit FIFO by the CPU. The transmit tasks routine
+    points a DMA channel at it and masks the transmit interrupt. The channel
+    moves one byte per UART5 transmit interrupt event and raises its block
+    complete interrupt after the last one, where DRV_USART0_TasksTransmitDma
+    either loads the next 256 byte chunk or unmasks the transmit interrupt. The
+    transmit tasks routine then completes the buffer as usual and moves on
+    to the next buffer or to the transmit rings.
+
+  Remarks:
+    The channel reads the client buffer until the buffer event handler
+    reports it complete. Both vectors run at DRV_USART_INT_PRIORITY_IDX0 so
+    they never preempt each other.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "system_config.h"
+#include "system_definitions.h"
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+
+#if (DRV_USART_INTERRUPT_MODE == false) || (DRV_USART_BUFFER_QUEUE_SUPPORT == false)
+#error "DRV_USART_SUPPORT_TRANSMIT_DMA requires DRV_USART_INTERRUPT_MODE and DRV_USART_BUFFER_QUEUE_SUPPORT"
+#endif
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+#error "The DMA channel cannot be paused by CTS, turn off DRV_USART_SUPPORT_TRANSMIT_DMA or DRV_USART_FLOW_CONTROL_IDX0"
+#endif
+
+/* Largest block of one channel transfer. DCHxSSIZ is 8 bits on the
+   PIC32MX, a size of 0 stands for 256 bytes. */
+#define _DRV_USART_DMA_BLOCK_MAX        256u
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+extern DRV_USART_OBJ  gDrvUSART0Obj ;
+extern DRV_USART_BUFFER_OBJ gDrvUSART0WriteQueue[DRV_USART_XMIT_QUEUE_SIZE_IDX0];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Instance 0 static driver functions
+// *****************************************************************************
+// *****************************************************************************
+
+void DRV_USART0_TasksTransmitDma(void)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+    DRV_USART_BUFFER_OBJ * bufferObj;
+    uint8_t tail;
+
+    if(!SYS_INT_SourceStatusGet(DRV_USART_XMIT_DMA_INT_SRC_IDX0))
+    {
+        return;
+    }
+
+    SYS_INT_SourceStatusClear(DRV_USART_XMIT_DMA_INT_SRC_IDX0);
+
+    if(!dObj->txDmaActive)
+    {
+        return;
+    }
+
+    tail = dObj->writeQueue.tail;
+    bufferObj = &gDrvUSART0WriteQueue[tail & (DRV_USART_XMIT_QUEUE_SIZE_IDX0 - 1)];
+
+    if(PLIB_DMA_ChannelXINTSourceFlagGet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_ADDRESS_ERROR))
+    {
+        /* The buffer is not in data RAM or program flash. Stop the
+           channel and report the buffer as failed. */
+        PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_ADDRESS_ERROR);
+        PLIB_DMA_ChannelXDisable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0);
+        dObj->txDmaActive = false;
+
+        if(dObj->eventHandler != NULL)
+        {
+            dObj->interruptNestingCount ++;
+
+            dObj->eventHandler(DRV_USART_BUFFER_EVENT_ERROR,
+                    bufferObj->bufferHandle,
+                    dObj->context);
+
+            dObj->interruptNestingCount -- ;
+        }
+
+        _DRV_USART_MEMORY_BARRIER();
+        dObj->writeQueue.tail = tail + 1;
+    }
+    else if(PLIB_DMA_ChannelXINTSourceFlagGet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_BLOCK_TRANSFER_COMPLETE))
+    {
+        PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_BLOCK_TRANSFER_COMPLETE);
+
+        if(bufferObj->nCurrentBytes < bufferObj->size)
+        {
+            /* Longer than one block. The forced first byte of the next
+               chunk keeps the channel going even if the FIFO empty event
+               has already passed, the FIFO has room for both. */
+            _DRV_USART0_TxDmaStart(bufferObj);
+            return;
+        }
+
+        /* All bytes are in the FIFO. The transmit tasks routine completes
+           the buffer on the next FIFO empty event. */
+        dObj->txDmaActive = false;
+    }
+    else
+    {
+        return;
+    }
+
+    /* The transmit flag was latched by the events that paced the channel,
+       a stale one would start a ring burst on a FIFO that is not empty */
+    _DRV_USART_TX_SOURCE_ENABLE();
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local functions
+// *****************************************************************************
+// *****************************************************************************
+
+void _DRV_USART0_TxDmaInitialize(void)
+{
+    gDrvUSART0Obj.txDmaActive = false;
+
+    PLIB_DMA_Enable(DMA_ID_0);
+    PLIB_DMA_ChannelXDisable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0);
+    PLIB_DMA_ChannelXPrioritySelect(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_CHANNEL_PRIORITY_0);
+
+    /* One byte to UxTXREG per transmit interrupt event */
+    PLIB_DMA_ChannelXTriggerEnable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_CHANNEL_TRIGGER_TRANSFER_START);
+    PLIB_DMA_ChannelXStartIRQSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_TRIGGER_USART_5_TRANSMIT);
+    PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0,
+            KVA_TO_PA(PLIB_USART_TransmitterAddressGet(USART_ID_5)));
+    PLIB_DMA_ChannelXDestinationSizeSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, 1);
+    PLIB_DMA_ChannelXCellSizeSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, 1);
+
+    PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_BLOCK_TRANSFER_COMPLETE);
+    PLIB_DMA_ChannelXINTSourceFlagClear(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_ADDRESS_ERROR);
+    PLIB_DMA_ChannelXINTSourceEnable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_BLOCK_TRANSFER_COMPLETE);
+    PLIB_DMA_ChannelXINTSourceEnable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0, DMA_INT_ADDRESS_ERROR);
+
+    SYS_INT_SourceStatusClear(DRV_USART_XMIT_DMA_INT_SRC_IDX0);
+    SYS_INT_SourceEnable(DRV_USART_XMIT_DMA_INT_SRC_IDX0);
+}
+
+void _DRV_USART0_TxDmaStart(DRV_USART_BUFFER_OBJ * bufferObj)
+{
+    size_t nCurrentBytes = bufferObj->nCurrentBytes;
+    size_t block = bufferObj->size - nCurrentBytes;
+
+    if(block > _DRV_USART_DMA_BLOCK_MAX)
+    {
+        block = _DRV_USART_DMA_BLOCK_MAX;
+    }
+
+    /* Counted as sent once the channel owns them, like a FIFO burst */
+    bufferObj->nCurrentBytes = nCurrentBytes + block;
+    _DRV_USART_STATS_ADD(txBytes, block);
+
+    /* The CPU stays off the FIFO until DRV_USART0_TasksTransmitDma */
+    gDrvUSART0Obj.txDmaActive = true;
+    SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+
+    PLIB_DMA_ChannelXSourceStartAddressSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0,
+            KVA_TO_PA(&bufferObj->buffer[nCurrentBytes]));
+    PLIB_DMA_ChannelXSourceSizeSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0,
+            (uint16_t)(block & 0xFFu));
+    PLIB_DMA_ChannelXEnable(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0);
+
+    /* The FIFO empty event that got us here is gone, move the first byte
+       by software. Its departure from the FIFO triggers the next one. */
+    PLIB_DMA_StartTransferSet(DMA_ID_0, DRV_USART_XMIT_DMA_CH_IDX0);
+}
+
+#endif /* DRV_USART_SUPPORT_TRANSMIT_DMA */
+
+/*******************************************************************************
+ End of File
+*/
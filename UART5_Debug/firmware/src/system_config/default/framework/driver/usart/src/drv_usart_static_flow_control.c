@@ -0,0 +1,145 @@
+/*******************************************************************************
+  USART driver static implementation of the RTS/CTS handshake.
+
+  Company:
+    BTC POWER.
+
+  File Name:
+    drv_usart_static_flow_control.c
+
+  Summary:
+    Source code for the USART driver static software handshake.
+
+  Description:
+    UART5 of the PIC32MX795F512L has no UxCTS and UxRTS pins, so the
+    handshake runs on two general purpose pins set up by SYS_PORTS_Initialize.
+    Both lines are active low. The transmit tasks routine checks CTS before
+    each FIFO burst and, while the host holds it high, masks the transmit
+    interrupt and accounts the stall. DRV_USART0_FlowControlTasks, called from
+    the system tasks routine, unmasks it once CTS returns. The receive ring
+    drives RTS high when it fills up to DRV_USART_RTS_OFF_IDX0 bytes and low
+    again once the client has drained it to DRV_USART_RTS_ON_IDX0.
+
+  Remarks:
+    CTS is sampled once per burst, so up to one FIFO (8 bytes) can still
+    leave after the host raises it. Without the receive ring RTS stays low.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "system_config.h"
+#include "system_definitions.h"
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+
+#if (DRV_USART_RX_RING_SUPPORT == true) && \
+    ((DRV_USART_RTS_ON_IDX0 >= DRV_USART_RTS_OFF_IDX0) || (DRV_USART_RTS_OFF_IDX0 > DRV_USART_RX_RING_SIZE_IDX0))
+#error "DRV_USART_RTS_ON_IDX0 must be below DRV_USART_RTS_OFF_IDX0, which must fit the receive ring"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+extern DRV_USART_OBJ  gDrvUSART0Obj ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Instance 0 static driver functions
+// *****************************************************************************
+// *****************************************************************************
+
+void DRV_USART0_FlowControlTasks(void)
+{
+#if (DRV_USART_INTERRUPT_MODE == true)
+    bool interruptWasEnabled;
+
+    interruptWasEnabled = SYS_INT_Disable();
+
+    if(gDrvUSART0Obj.txStalled && _DRV_USART_CTS_IS_ASSERTED())
+    {
+        /* The flag comes back once the last burst has left, the transmit
+           tasks routine ends the stall and masks the source again if
+           nothing is pending */
+        _DRV_USART_TX_SOURCE_ENABLE();
+    }
+
+    SYS_INT_Restore(interruptWasEnabled);
+#endif
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local functions
+// *****************************************************************************
+// *****************************************************************************
+
+void _DRV_USART0_FlowControlInitialize(void)
+{
+    gDrvUSART0Obj.txStalled = false;
+    gDrvUSART0Obj.txStallStart = 0;
+    gDrvUSART0Obj.rtsDeasserted = false;
+
+    /* SYS_PORTS_Initialize holds RTS high until the receiver is ready */
+    _DRV_USART_RTS_ASSERT();
+}
+
+bool _DRV_USART0_TxStalled(void)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+
+    if(_DRV_USART_CTS_IS_ASSERTED())
+    {
+        if(dObj->txStalled)
+        {
+            dObj->txStalled = false;
+            _DRV_USART_STATS_ADD(ctsStallTicks, _CP0_GET_COUNT() - dObj->txStallStart);
+        }
+        return false;
+    }
+
+    if(!dObj->txStalled)
+    {
+        dObj->txStalled = true;
+        dObj->txStallStart = _CP0_GET_COUNT();
+        _DRV_USART_STATS_ADD(ctsStalls, 1);
+    }
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+    /* The flag stays set while the FIFO is empty, mask it until
+       DRV_USART0_FlowControlTasks sees CTS again */
+    SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+#endif
+
+    return true;
+}
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+void _DRV_USART0_RtsUpdate(uint32_t used)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+
+    if((!dObj->rtsDeasserted) && (used >= DRV_USART_RTS_OFF_IDX0))
+    {
+        _DRV_USART_RTS_DEASSERT();
+        dObj->rtsDeasserted = true;
+        _DRV_USART_STATS_ADD(rtsDeasserts, 1);
+    }
+    else if((dObj->rtsDeasserted) && (used <= DRV_USART_RTS_ON_IDX0))
+    {
+        _DRV_USART_RTS_ASSERT();
+        dObj->rtsDeasserted = false;
+    }
+}
+#endif
+
+#endif /* DRV_USART_FLOW_CONTROL_IDX0 */
+
+/*******************************************************************************
+ End of File
+*/
@@ -75,6 +75,73 @@ SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
 /* USART FIFO+RX(8+1) size */
 #define _DRV_USART_RX_DEPTH     9
 
+/* USART transmit FIFO size. The transmit interrupt fires once the FIFO is
+   empty, so the transmit tasks routine can write this many bytes without
+   polling the buffer full flag. This holds only while the flag is never
+   left set from an earlier empty FIFO, see _DRV_USART_TX_SOURCE_ENABLE. */
+#define _DRV_USART_TX_DEPTH     8
+
+/* Unmasks the transmit interrupt. The flag is latched: it stays set while
+   the source is masked, also after the FIFO has been filled again, and a
+   burst started on such a stale flag overruns the FIFO. It is cleared
+   first; with the interrupt set to FIFO empty the UART raises it again at
+   once when the FIFO really is empty. */
+#define _DRV_USART_TX_SOURCE_ENABLE()                                   \
+    do                                                                  \
+    {                                                                   \
+        SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_TRANSMIT);         \
+        SYS_INT_SourceEnable(INT_SOURCE_USART_5_TRANSMIT);              \
+    } while(0)
+
+/* Keeps the compiler from moving buffer stores past the publication of a
+   ring index that another execution context reads. */
+#define _DRV_USART_MEMORY_BARRIER()     __asm__ __volatile__ ("" ::: "memory")
+
+// *****************************************************************************
+/* USART Driver Baud Rate Generator Macros
+
+  Summary:
+    Baud rate generator divisor, resulting rate and rate error.
+
+  Description:
+    The baud rate generator divides the peripheral clock by 16 * (BRG + 1)
+    with BRGH clear and by 4 * (BRG + 1) with BRGH set. The divisor is
+    rounded to the nearest value instead of truncated, and the error is the
+    absolute difference between the resulting and the requested rate in
+    hundredths of a percent. The macros are evaluated by the preprocessor
+    for DRV_USART_BAUD_RATE_IDX0, so a divisor below zero shows up as a
+    value above 0xFFFF.
+
+  Remarks:
+    None.
+*/
+
+#define _DRV_USART_BRG_MAX                      0xFFFFull
+#define _DRV_USART_BRG(clock, baud, div)        ((((clock) + ((div) * (baud)) / 2ull) / ((div) * (baud))) - 1ull)
+#define _DRV_USART_BAUD(clock, brg, div)        ((clock) / ((div) * ((brg) + 1ull)))
+#define _DRV_USART_BAUD_ERROR(actual, baud)     \
+    (((((actual) > (baud)) ? ((actual) - (baud)) : ((baud) - (actual))) * 10000ull) / (baud))
+
+/* Both candidates for the configured rate, an out of range divisor gets the
+   largest error so that it is never selected */
+#define _DRV_USART_BRG_LOW_IDX0     _DRV_USART_BRG(SYS_CLK_BUS_PERIPHERAL_1, DRV_USART_BAUD_RATE_IDX0, 16ull)
+#define _DRV_USART_BRG_HIGH_IDX0    _DRV_USART_BRG(SYS_CLK_BUS_PERIPHERAL_1, DRV_USART_BAUD_RATE_IDX0, 4ull)
+#define _DRV_USART_ERROR_LOW_IDX0   ((_DRV_USART_BRG_LOW_IDX0 > _DRV_USART_BRG_MAX) ? 0xFFFFFFFFull : \
+    _DRV_USART_BAUD_ERROR(_DRV_USART_BAUD(SYS_CLK_BUS_PERIPHERAL_1, _DRV_USART_BRG_LOW_IDX0, 16ull), DRV_USART_BAUD_RATE_IDX0))
+#define _DRV_USART_ERROR_HIGH_IDX0  ((_DRV_USART_BRG_HIGH_IDX0 > _DRV_USART_BRG_MAX) ? 0xFFFFFFFFull : \
+    _DRV_USART_BAUD_ERROR(_DRV_USART_BAUD(SYS_CLK_BUS_PERIPHERAL_1, _DRV_USART_BRG_HIGH_IDX0, 4ull), DRV_USART_BAUD_RATE_IDX0))
+
+/* BRGH clear samples each bit three times, it is kept on a tie */
+#if (_DRV_USART_ERROR_LOW_IDX0 <= _DRV_USART_ERROR_HIGH_IDX0)
+#define _DRV_USART_BRGH_IDX0        false
+#define _DRV_USART_BRG_IDX0         ((uint16_t)_DRV_USART_BRG_LOW_IDX0)
+#define _DRV_USART_BAUD_ERROR_IDX0  _DRV_USART_ERROR_LOW_IDX0
+#else
+#define _DRV_USART_BRGH_IDX0        true
+#define _DRV_USART_BRG_IDX0         ((uint16_t)_DRV_USART_BRG_HIGH_IDX0)
+#define _DRV_USART_BAUD_ERROR_IDX0  _DRV_USART_ERROR_HIGH_IDX0
+#endif
+
 // *****************************************************************************
 /* USART Driver Buffer Handle Macros
 
@@ -103,101 +170,514 @@ SUBSTITUTE  GOODS,  TECHNOLOGY,  SERVICES,  OR  ANY  CLAIMS  BY  THIRD   PARTIES
         (token) = (token); \
 }
 
-/* USART Buffer Object Flags */
-typedef enum
+// *****************************************************************************
+/* USART Driver Buffer Object
+
+  Summary:
+    Descriptor of a client's buffer in a buffer queue.
+
+  Description:
+    The read and write queues are fixed arrays of these descriptors, see
+    DRV_USART_BUFFER_QUEUE. The descriptor only lives in its queue slot, so it
+    needs no list links or usage flags.
+
+  Remarks:
+    None.
+*/
+
+typedef struct
+{
+    /* Pointer to the application read or write buffer */
+    uint8_t * buffer;
+
+    /* Number of bytes to be transferred */
+    size_t size;
+
+    /* Tracks how much data has been transferred */
+    size_t nCurrentBytes;
+
+    /* Buffer Handle that was assigned to this buffer when it was added to the
+     * queue. */
+    DRV_USART_BUFFER_HANDLE bufferHandle;
+
+} DRV_USART_BUFFER_OBJ;
+
+// *****************************************************************************
+/* USART Driver Buffer Queue
+
+  Summary:
+    Head and tail indices of a buffer queue.
+
+  Description:
+    A buffer queue is a power of two array of DRV_USART_BUFFER_OBJ used as a
+    single producer, single consumer ring. The client that adds buffers fills
+    the slot at head and then advances head. The tasks routine serves the slot
+    at tail and advances tail once the buffer is complete. Each index has a
+    single writer, so neither side disables interrupts.
+
+  Remarks:
+    The indices run freely and are masked with the queue size minus one on
+    access, which limits a queue to 128 entries.
+*/
+
+typedef struct
+{
+    /* Next slot to fill, written only by the client */
+    volatile uint8_t head;
+
+    /* Slot being served, written only by the tasks routine */
+    volatile uint8_t tail;
+
+} DRV_USART_BUFFER_QUEUE;
+
+#define _DRV_USART_QUEUE_IS_EMPTY(queue)    ((queue).head == (queue).tail)
+#define _DRV_USART_QUEUE_COUNT(queue)       ((uint8_t)((queue).head - (queue).tail))
+
+// *****************************************************************************
+/* USART Driver Segment
+
+  Summary:
+    One piece of a record written with a vectored write.
+
+  Description:
+    DRV_USART0_TxLaneWriteV takes an array of these and stores the pieces
+    back to back as one record, so a header, a payload and a trailer kept
+    in different places need no staging buffer.
+
+  Remarks:
+    A segment with a length of zero may have a NULL buffer.
+*/
+
+typedef struct
 {
-    /* Indicates this buffer was submitted by a read write function */
-    DRV_USART_BUFFER_OBJ_FLAG_READ_WRITE = 1 << 0,
+    /* First byte of the piece */
+    const void * buffer;
 
-    /* Indicates this buffer was submitted by a buffer add read write function
-       */
-    DRV_USART_BUFFER_OBJ_FLAG_BUFFER_ADD = 1 << 1
+    /* Number of bytes in the piece */
+    size_t length;
 
-} DRV_USART_BUFFER_OBJ_FLAGS;
+} DRV_USART_SEGMENT;
 
+#if (DRV_USART_TX_RING_SUPPORT == true)
 // *****************************************************************************
-/* USART Driver Buffer States
-
-   Summary
-    Identifies the possible state of the buffer that can result from a 
-    buffer add/delete request.
-
-   Description
-    This enumeration identifies the possible state of the buffer that can 
-    result from a buffer add/delete request by the client by calling,
-      - DRV_USART_BufferAddRead : Updates state to DRV_USART_BUFFER_IS_IN_READ_QUEUE
-      - DRV_USART_BufferAddWrite : Updates state to DRV_USART_BUFFER_IS_IN_WRITE_QUEUE
-      - DRV_USART_BufferRemove : Updates state to DRV_USART_BUFFER_IS_FREE.
-    
-   Remarks:
-    DRV_USART_BUFFER_IS_FREE is the state of the buffer which is in the 
-    free buffer pool.
+/* USART Driver Transmit Lanes
 
+  Summary:
+    Identifies the transmit ring a record is queued on.
+
+  Description:
+    The transmit tasks routine always serves the high priority lane first.
+    A record that has started on the wire is always finished before the
+    routine switches lanes, so records are never interleaved.
+
+  Remarks:
+    None.
 */
 
 typedef enum
 {
-    /* Buffer is not added to either write or read queue. In other words,
-     * the buffer is in the free pool. */
-    DRV_USART_BUFFER_IS_FREE,
+    /* Served first, reserved for urgent records such as error reports */
+    DRV_USART_TX_LANE_HIGH = 0,
+
+    /* Everything else */
+    DRV_USART_TX_LANE_NORMAL,
 
-    /* Buffer is added to the write queue. */
-    DRV_USART_BUFFER_IS_IN_WRITE_QUEUE,
+    /* Number of lanes */
+    DRV_USART_TX_LANES_NUMBER
 
-    /* Buffer is added to the read queue */
-    DRV_USART_BUFFER_IS_IN_READ_QUEUE
+} DRV_USART_TX_LANE;
 
-} DRV_USART_BUFFER_STATE;
+/* Size of the record length header stored in front of each record */
+#define _DRV_USART_TX_RECORD_HEADER     2
+
+/* Longest record. The top bit of the length header marks a pad record,
+   space at the end of the ring the consumer skips without sending. */
+#define _DRV_USART_TX_RECORD_MAX        0x7FFFu
+#define _DRV_USART_TX_RECORD_PAD        0x8000u
 
 // *****************************************************************************
-/* USART Driver Buffer Object
+/* USART Driver Transmit Ring Object
+
+  Summary:
+    Single producer, single consumer byte ring feeding the transmitter.
+
+  Description:
+    The client copies outgoing records into a ring and returns at once. The
+    transmit tasks routine drains the rings into the hardware FIFO. Each
+    record is stored behind a two byte little endian length header. The head
+    index is only written by the producer and the tail index is only written
+    by the consumer, so the two sides never need to lock each other out.
+
+  Remarks:
+    The indices run freely and are masked on access, which requires every
+    ring size to be a power of two.
+*/
+
+typedef struct
+{
+    /* Ring storage */
+    uint8_t * buffer;
+
+    /* Ring size minus one */
+    uint32_t mask;
+
+    /* Write index, advanced by the producer only */
+    volatile uint32_t head;
+
+    /* Read index, advanced by the consumer only */
+    volatile uint32_t tail;
+
+    /* Number of records accepted */
+    uint32_t recordCount;
+
+    /* Number of records rejected because the ring was full */
+    uint32_t dropCount;
+
+    /* Number of bytes belonging to rejected records */
+    uint32_t dropBytes;
+
+    /* Highest ring occupancy seen, in bytes */
+    uint32_t highWater;
+
+    /* Where the header of the reserved record goes, behind any pad record */
+    uint32_t reserveHead;
+
+    /* Bytes handed out by DRV_USART0_TxLaneReserve, 0 when none are */
+    size_t reserved;
+
+} DRV_USART_TX_RING_OBJ;
+
+// *****************************************************************************
+/* USART Driver Transmit Ring Status
 
   Summary:
-    Object used to keep track of a client's buffer.
+    Snapshot of one transmit lane's occupancy and loss counters.
 
   Description:
-    This object is used to keep track of a client's buffer in the driver's
-    queue.
+    This structure is filled by DRV_USART0_TxRingStatusGet.
+
+  Remarks:
+    Byte counts include the record length headers.
+*/
+
+typedef struct
+{
+    /* Ring capacity in bytes */
+    uint32_t size;
+
+    /* Bytes waiting to be transmitted */
+    uint32_t used;
+
+    /* Highest occupancy seen since initialization */
+    uint32_t highWater;
+
+    /* Records accepted since initialization */
+    uint32_t recordCount;
+
+    /* Records rejected because the ring was full */
+    uint32_t dropCount;
+
+    /* Bytes belonging to rejected records */
+    uint32_t dropBytes;
+
+} DRV_USART_TX_RING_STATUS;
+
+#endif
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+/* The receive interrupt fires at the configured FIFO level, anything below
+   it is collected by DRV_USART0_RxRingTasks */
+#define _DRV_USART_RX_FIFO_TRIGGER      DRV_USART_RX_FIFO_TRIGGER_IDX0
+#else
+#define _DRV_USART_RX_FIFO_TRIGGER      USART_RECEIVE_FIFO_ONE_CHAR
+#endif
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+// *****************************************************************************
+/* USART Driver Receive Ring Events
+
+  Summary:
+    Identifies why the receive ring event handler was called.
+
+  Description:
+    WATERMARK and LINE are reported from the receive tasks routine as the
+    bytes arrive, IDLE is reported from DRV_USART0_RxRingTasks.
 
   Remarks:
     None.
 */
 
-typedef struct _DRV_USART_BUFFER_OBJ
+typedef enum
 {
-    /* Driver instance to which the buffer object belongs to */
-    uint8_t drvInstance;
+    /* The ring occupancy reached DRV_USART_RX_WATERMARK_IDX0 */
+    DRV_USART_RX_RING_EVENT_WATERMARK,
 
-    /* This flag tracks whether this object is in use */
-    volatile bool inUse;
+    /* DRV_USART_RX_EOL_CHAR_IDX0 was received */
+    DRV_USART_RX_RING_EVENT_LINE,
 
-    /* Pointer to the application read or write buffer */
+    /* Nothing was received for DRV_USART_RX_IDLE_US_IDX0 after the last byte */
+    DRV_USART_RX_RING_EVENT_IDLE
+
+} DRV_USART_RX_RING_EVENT;
+
+// *****************************************************************************
+/* USART Driver Receive Ring Event Handler
+
+  Summary:
+    Receive ring event handler function pointer.
+
+  Description:
+    `available` is the number of bytes in the ring when the event is raised.
+    The handler may call DRV_USART0_RxRingPeek and DRV_USART0_RxRingConsume.
+
+  Remarks:
+    WATERMARK and LINE are raised in interrupt context in interrupt mode.
+*/
+
+typedef void (*DRV_USART_RX_RING_EVENT_HANDLER)(DRV_USART_RX_RING_EVENT event, size_t available, uintptr_t context);
+
+// *****************************************************************************
+/* USART Driver Receive Ring Object
+
+  Summary:
+    Single producer, single consumer byte ring filled from the receiver.
+
+  Description:
+    The receive tasks routine moves every received byte into the ring as soon
+    as the FIFO trigger level is reached, so the hardware FIFO cannot overrun
+    while the client is busy. The client reads the data in place through
+    DRV_USART0_RxRingPeek and releases it with DRV_USART0_RxRingConsume.
+
+  Remarks:
+    The indices run freely and are masked on access, which requires the ring
+    size to be a power of two. Bytes received while the ring is full are
+    counted and dropped.
+*/
+
+typedef struct
+{
+    /* Ring storage */
     uint8_t * buffer;
 
-    /* Tracks how much data has been transferred */
-    size_t nCurrentBytes;
+    /* Ring size minus one */
+    uint32_t mask;
 
-    /* Number of bytes to be transferred */
-    size_t size;
+    /* Write index, advanced by the receive tasks routine only */
+    volatile uint32_t head;
 
-    /* Next buffer pointer */
-    struct _DRV_USART_BUFFER_OBJ * next;
+    /* Read index, advanced by the client only */
+    volatile uint32_t tail;
 
-    /* Previous buffer pointer */
-    struct _DRV_USART_BUFFER_OBJ * previous;
+    /* Number of bytes dropped because the ring was full */
+    uint32_t dropCount;
 
-    /* Flags that indicate the type of buffer */
-    DRV_USART_BUFFER_OBJ_FLAGS flags;
+    /* Core timer count when the last byte was received */
+    uint32_t lastRxCount;
 
-    /* Current state of the buffer */
-    DRV_USART_BUFFER_STATE currentState;
+    /* True until the idle event for the last burst has been raised */
+    bool idlePending;
 
-    /* Buffer Handle that was assigned to this buffer when it was added to the
-     * queue. */
-    DRV_USART_BUFFER_HANDLE bufferHandle;
+    /* Client event handler and its context */
+    DRV_USART_RX_RING_EVENT_HANDLER eventHandler;
+    uintptr_t context;
 
-} DRV_USART_BUFFER_OBJ;
+} DRV_USART_RX_RING_OBJ;
+
+#endif
+
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+// *****************************************************************************
+/* USART Driver Handshake Pin Macros
 
+  Summary:
+    Access to the general purpose pins used as CTS and RTS.
+
+  Description:
+    Both lines are active low. CTS low means the host can take data, RTS low
+    tells the host that the receive ring has room.
+
+  Remarks:
+    The pins are set up in SYS_PORTS_Initialize.
+*/
+
+#define _DRV_USART_CTS_IS_ASSERTED()    \
+    (!PLIB_PORTS_PinGet(PORTS_ID_0, DRV_USART_CTS_PORT_IDX0, DRV_USART_CTS_PIN_IDX0))
+#define _DRV_USART_RTS_ASSERT()         \
+    PLIB_PORTS_PinClear(PORTS_ID_0, DRV_USART_RTS_PORT_IDX0, DRV_USART_RTS_PIN_IDX0)
+#define _DRV_USART_RTS_DEASSERT()       \
+    PLIB_PORTS_PinSet(PORTS_ID_0, DRV_USART_RTS_PORT_IDX0, DRV_USART_RTS_PIN_IDX0)
+#endif
+
+// *****************************************************************************
+/* USART Driver Baud Rate Set Timeout
+
+  Summary:
+    DRV_USART0_BaudSet result when the transmitter did not go idle in time.
+
+  Description:
+    The data already handed to the DMA channel or the transmit FIFO did not
+    leave within DRV_USART_BAUD_SET_TIMEOUT_US_IDX0, for example because the
+    receiver holds CTS. The baud rate generator is left unchanged and the
+    data keeps leaving at the old rate.
+
+  Remarks:
+    Extends DRV_USART_BAUD_SET_RESULT, which only has SUCCESS and ERROR.
+*/
+
+#define DRV_USART_BAUD_SET_TIMEOUT      ((DRV_USART_BAUD_SET_RESULT)2)
+
+// *****************************************************************************
+/* USART Driver Baud Rate Status
+
+  Summary:
+    Baud rate generator setting of a driver instance.
+
+  Description:
+    Describes the rate last programmed by DRV_USART0_Initialize or
+    DRV_USART0_BaudSet and how far the generated rate is from it.
+
+  Remarks:
+    This structure is filled by DRV_USART0_BaudStatusGet.
+*/
+
+typedef struct
+{
+    /* Rate asked for */
+    uint32_t requested;
+
+    /* Rate produced by the baud rate generator */
+    uint32_t actual;
+
+    /* (actual - requested) / requested, in hundredths of a percent */
+    int32_t errorHundredths;
+
+    /* Programmed divisor and high speed mode */
+    uint16_t brg;
+    bool brgh;
+
+} DRV_USART_BAUD_STATUS;
+
+#if (DRV_USART_STATISTICS == true)
+// *****************************************************************************
+/* USART Driver Statistics
+
+  Summary:
+    Traffic, error and occupancy counters of a driver instance.
+
+  Description:
+    The counters are plain increments done where the event happens and are
+    never cleared, so two snapshots taken with DRV_USART0_StatsGet can be
+    subtracted. High water marks are in queue entries or ring bytes.
+
+  Remarks:
+    Most counters are only written from one execution context. txBytes and
+    rxBytes are also counted by DRV_USART0_Write and DRV_USART0_Read in task
+    context; those updates use _DRV_USART_STATS_ADD_TASK, which masks the
+    interrupts so the read-modify-write cannot lose an ISR update.
+*/
+
+typedef struct
+{
+    /* Bytes written to the transmit FIFO */
+    uint32_t txBytes;
+
+    /* Bytes taken from the receive FIFO, including dropped ones */
+    uint32_t rxBytes;
+
+    /* DRV_USART0_Write calls that stopped on a full transmit FIFO */
+    uint32_t txFifoFull;
+
+    /* Receive errors seen by _DRV_USART0_ErrorConditionClear */
+    uint32_t overrunErrors;
+    uint32_t framingErrors;
+    uint32_t parityErrors;
+
+    /* Bytes discarded while clearing receive errors */
+    uint32_t flushedBytes;
+
+    /* Transmit, receive and error tasks runs with the interrupt flag set */
+    uint32_t txInterrupts;
+    uint32_t rxInterrupts;
+    uint32_t errorInterrupts;
+
+    /* Deepest write and read buffer queue, in buffers */
+    uint32_t writeQueueHighWater;
+    uint32_t readQueueHighWater;
+
+    /* Highest receive ring occupancy and bytes lost to a full ring */
+    uint32_t rxRingHighWater;
+    uint32_t rxRingDropBytes;
+
+    /* Transmit stalls on a deasserted CTS and their total length in core
+       timer ticks */
+    uint32_t ctsStalls;
+    uint32_t ctsStallTicks;
+
+    /* Times RTS was deasserted because the receive ring filled up */
+    uint32_t rtsDeasserts;
+
+} DRV_USART_STATS;
+
+#define _DRV_USART_STATS_ADD(field, n)      (gDrvUSART0Obj.stats.field += (n))
+#define _DRV_USART_STATS_MAX(field, value)  \
+{ \
+    if((value) > gDrvUSART0Obj.stats.field) \
+        gDrvUSART0Obj.stats.field = (value); \
+}
+#if (DRV_USART_INTERRUPT_MODE == true)
+#define _DRV_USART_STATS_ADD_TASK(field, n) \
+{ \
+    bool _statsInterruptState = SYS_INT_Disable(); \
+    gDrvUSART0Obj.stats.field += (n); \
+    SYS_INT_Restore(_statsInterruptState); \
+}
+#else
+#define _DRV_USART_STATS_ADD_TASK(field, n) _DRV_USART_STATS_ADD(field, n)
+#endif
+#else
+#define _DRV_USART_STATS_ADD(field, n)
+#define _DRV_USART_STATS_MAX(field, value)
+#define _DRV_USART_STATS_ADD_TASK(field, n)
+#endif
+
+#if (DRV_USART_ISR_PROFILE == true)
+// *****************************************************************************
+/* USART Driver ISR Profile
+
+  Summary:
+    Interrupt latency and ISR body time, in core timer ticks.
+
+  Description:
+    The latency runs from the moment the transmit source is enabled with the
+    flag already pending to the first statement of the ISR, so it includes
+    the hardware latency and the ISR prologue. The body time runs from the
+    first to the last statement of the ISR. One core timer tick is two
+    system clock cycles.
+
+  Remarks:
+    This structure is filled by DRV_USART0_IsrProfileGet.
+*/
+
+typedef struct
+{
+    /* ISR executions measured */
+    uint32_t count;
+
+    /* Executions with a latency sample */
+    uint32_t latencyCount;
+
+    /* Shortest and longest latency */
+    uint32_t latencyMin;
+    uint32_t latencyMax;
+
+    /* Shortest and longest ISR body */
+    uint32_t bodyMin;
+    uint32_t bodyMax;
+
+} DRV_USART_ISR_PROFILE_DATA;
+
+#endif
 
 // *****************************************************************************
 /* USART Static Driver Instance Object
@@ -221,16 +701,10 @@ typedef struct
     uint32_t interruptNestingCount;
 
     /* The buffer Q for the write operations */
-    DRV_USART_BUFFER_OBJ  *queueWrite;
+    DRV_USART_BUFFER_QUEUE writeQueue;
 
     /* The buffer Q for the read operations */
-    DRV_USART_BUFFER_OBJ  *queueRead;
-
-    /* Current read queue size */
-    size_t queueSizeCurrentRead;
-
-    /* Current write queue size */
-    size_t queueSizeCurrentWrite;
+    DRV_USART_BUFFER_QUEUE readQueue;
 
     /* Application Context associated with the client */
     uintptr_t context;
@@ -241,6 +715,56 @@ typedef struct
     /* Client specific error */
     DRV_USART_ERROR error;
 
+    /* Baud rate generator setting reported by DRV_USART0_BaudStatusGet */
+    DRV_USART_BAUD_STATUS baud;
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    /* Transmit rings drained by the transmit tasks routine, one per lane */
+    DRV_USART_TX_RING_OBJ txRing[DRV_USART_TX_LANES_NUMBER];
+
+    /* Lane of the record being transmitted */
+    DRV_USART_TX_LANE txLaneActive;
+
+    /* Bytes of that record still to be transmitted */
+    uint32_t txRecordRemaining;
+#endif
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    /* Receive ring filled by the receive tasks routine */
+    DRV_USART_RX_RING_OBJ rxRing;
+#endif
+
+#if (DRV_USART_STATISTICS == true)
+    /* Counters reported by DRV_USART0_StatsGet */
+    DRV_USART_STATS stats;
+#endif
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    /* True while the host holds CTS deasserted */
+    bool txStalled;
+
+    /* Core timer count when the current stall began */
+    uint32_t txStallStart;
+
+    /* True while RTS is deasserted */
+    bool rtsDeasserted;
+#endif
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    /* True while the DMA channel feeds the transmit FIFO */
+    volatile bool txDmaActive;
+#endif
+
+#if (DRV_USART_ISR_PROFILE == true)
+    /* Core timer count when the transmit source was last enabled */
+    uint32_t isrTriggerCount;
+
+    /* True until the ISR has taken the latency sample */
+    volatile bool isrTriggerArmed;
+
+    /* Measurements reported by DRV_USART0_IsrProfileGet */
+    DRV_USART_ISR_PROFILE_DATA isrProfile;
+#endif
 
 } DRV_USART_OBJ;
 
@@ -253,6 +777,29 @@ void _DRV_USART0_BufferQueueTxTasks(void);
 void _DRV_USART0_BufferQueueRxTasks(void);
 void _DRV_USART0_BufferQueueErrorTasks(void);
 void _DRV_USART0_ErrorConditionClear(void);
+void _DRV_USART0_BaudGeneratorSet(bool brgh, uint16_t brg);
+#if (DRV_USART_TX_RING_SUPPORT == true)
+void _DRV_USART0_TxRingInitialize(void);
+void _DRV_USART0_TxRingTasks(uint32_t room);
+#if (DRV_USART_INTERRUPT_MODE == true)
+void _DRV_USART0_TxRingInterruptUpdate(void);
+#endif
+#endif
+#if (DRV_USART_RX_RING_SUPPORT == true)
+void _DRV_USART0_RxRingInitialize(void);
+void _DRV_USART0_RxRingReceive(void);
+#endif
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+void _DRV_USART0_FlowControlInitialize(void);
+bool _DRV_USART0_TxStalled(void);
+#if (DRV_USART_RX_RING_SUPPORT == true)
+void _DRV_USART0_RtsUpdate(uint32_t used);
+#endif
+#endif
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+void _DRV_USART0_TxDmaInitialize(void);
+void _DRV_USART0_TxDmaStart(DRV_USART_BUFFER_OBJ * bufferObj);
+#endif
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus
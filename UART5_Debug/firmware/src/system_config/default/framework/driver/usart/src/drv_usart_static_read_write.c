@@ -51,6 +51,7 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 // Section: Included Files
 // *****************************************************************************
 // *****************************************************************************
+#include <string.h>
 #include "system_config.h"
 #include "system_definitions.h"
 
@@ -72,6 +73,10 @@ size_t DRV_USART0_Read(void * destination,const size_t nBytes)
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
     uint8_t * data;
     size_t count = 0;
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    const uint8_t * ringData;
+    size_t chunk;
+#endif
 
     dObj = &gDrvUSART0Obj;
 
@@ -88,12 +93,36 @@ size_t DRV_USART0_Read(void * destination,const size_t nBytes)
     
     data = (uint8_t *)destination;
 
-    if(dObj->queueRead != NULL)
+    if(!_DRV_USART_QUEUE_IS_EMPTY(dObj->readQueue))
     {
         /* This means queue is not empty. We cannot read
            data now. */
         count = 0;
     }
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    else if(dObj->error != DRV_USART_ERROR_NONE)
+    {
+        /* The error tasks routine recorded a receive error, report it
+           once */
+        dObj->error = DRV_USART_ERROR_NONE;
+        return(DRV_USART_READ_ERROR);
+    }
+    else
+    {
+        /* The receive tasks routine owns the FIFO. Copy out of the
+           receive ring, in two parts across the wrap. */
+        while((count < nBytes) && ((chunk = DRV_USART0_RxRingPeek(&ringData)) != 0))
+        {
+            if(chunk > (nBytes - count))
+            {
+                chunk = nBytes - count;
+            }
+            memcpy(&data[count], ringData, chunk);
+            DRV_USART0_RxRingConsume(chunk);
+            count += chunk;
+        }
+    }
+#else
     else
     {
         while((PLIB_USART_ReceiverDataIsAvailable(USART_ID_5)) && (count < nBytes))
@@ -116,7 +145,9 @@ size_t DRV_USART0_Read(void * destination,const size_t nBytes)
             data[count] = PLIB_USART_ReceiverByteReceive(USART_ID_5);
             count ++;
         }
+        _DRV_USART_STATS_ADD_TASK(rxBytes, count);
     }
+#endif
     return(count);
 }
 
@@ -124,6 +155,7 @@ size_t DRV_USART0_Write(void * source, const size_t nBytes)
 {
     DRV_USART_OBJ *dObj = (DRV_USART_OBJ*)NULL;
     size_t count = 0;
+    size_t burst;
     uint8_t * data;
 
     dObj = &gDrvUSART0Obj;
@@ -141,31 +173,72 @@ size_t DRV_USART0_Write(void * source, const size_t nBytes)
 
     /* This is a non blocking implementation*/
 
-    if(dObj->queueWrite != NULL)
+    if(!_DRV_USART_QUEUE_IS_EMPTY(dObj->writeQueue))
     {
         /* This means queue is not empty. We cannot send
            data now. */
         count = 0;
     }
+#if (DRV_USART_TX_RING_SUPPORT == true)
+    else if(!DRV_USART0_TxRingIsEmpty())
+    {
+        /* The transmit ring still holds earlier data. Writing now
+           would reorder the output. */
+        count = 0;
+    }
+#endif
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    else if(_DRV_USART0_TxStalled())
+    {
+        /* The host holds CTS deasserted */
+        count = 0;
+    }
+#endif
     else
     {
+        /* An idle transmitter has the whole FIFO free. Write one burst
+           with a single status check instead of one per byte. */
+        if(PLIB_USART_TransmitterIsEmpty(USART_ID_5))
+        {
+            burst = (nBytes < _DRV_USART_TX_DEPTH) ? nBytes : _DRV_USART_TX_DEPTH;
+            while(count < burst)
+            {
+                PLIB_USART_TransmitterByteSend(USART_ID_5, data[count]);
+                count ++;
+            }
+        }
+
         while((!PLIB_USART_TransmitterBufferIsFull(USART_ID_5)) && (count < nBytes))
         {
             /* This is not a blocking implementation. We write
                to the hardware till the FIFO is full. */
             PLIB_USART_TransmitterByteSend(USART_ID_5, data[count]);
             count ++;
+        }
 
-            /* We need to check for errors. Store the error
-               in the client error field. */
+        if(count != 0)
+        {
+            /* The FIFO is no longer empty, drop the flag latched while it
+               was so the transmit tasks routine does not burst into it */
+            SYS_INT_SourceStatusClear(INT_SOURCE_USART_5_TRANSMIT);
+        }
 
-            dObj->error = PLIB_USART_ErrorsGet(USART_ID_5);
+        _DRV_USART_STATS_ADD_TASK(txBytes, count);
+        if(count < nBytes)
+        {
+            /* The caller has to come back for the rest */
+            _DRV_USART_STATS_ADD(txFifoFull, 1);
+        }
 
-            if(dObj->error != DRV_USART_ERROR_NONE)
-            {
-                /* This means we have an error.*/
-                return(DRV_USART_WRITE_ERROR);
-            }
+        /* We need to check for errors once per burst. Store the
+           error in the client error field. */
+
+        dObj->error = PLIB_USART_ErrorsGet(USART_ID_5);
+
+        if(dObj->error != DRV_USART_ERROR_NONE)
+        {
+            /* This means we have an error.*/
+            return(DRV_USART_WRITE_ERROR);
         }
     }
 
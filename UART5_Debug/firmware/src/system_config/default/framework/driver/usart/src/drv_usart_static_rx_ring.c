@@ -0,0 +1,244 @@
+/*******************************************************************************
+  USART driver static implementation of the receive ring.
+
+  Company:
+    BTC POWER.
+
+  File Name:
+    drv_usart_static_rx_ring.c
+
+  Summary:
+    Source code for the USART driver static receive ring.
+
+  Description:
+    This file contains a statically sized single producer, single consumer
+    byte ring behind the USART receiver. The receive tasks routine empties
+    the hardware FIFO into the ring whenever the FIFO trigger level is
+    reached and raises the watermark and end of line events. The client reads
+    the data in place and releases it when done. DRV_USART0_RxRingTasks,
+    called from the system tasks routine, collects bytes left below the
+    trigger level and raises the idle event.
+
+  Remarks:
+    The receive tasks routine only writes the head index and the client only
+    writes the tail index. Both indices run freely and are masked on access.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "system_config.h"
+#include "system_definitions.h"
+
+#if (DRV_USART_RX_RING_SUPPORT == true)
+
+#if ((DRV_USART_RX_RING_SIZE_IDX0 & (DRV_USART_RX_RING_SIZE_IDX0 - 1)) != 0)
+#error "DRV_USART_RX_RING_SIZE_IDX0 must be a power of two"
+#endif
+
+/* Idle gap in core timer ticks, the core timer runs at half the system clock */
+#define _DRV_USART_RX_IDLE_TICKS    ((SYS_CLK_FREQ / 2000000ul) * DRV_USART_RX_IDLE_US_IDX0)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+extern DRV_USART_OBJ  gDrvUSART0Obj ;
+
+/* Ring storage */
+static uint8_t gDrvUSART0RxRing[DRV_USART_RX_RING_SIZE_IDX0];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Instance 0 static driver functions
+// *****************************************************************************
+// *****************************************************************************
+
+size_t DRV_USART0_RxRingCount(void)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+
+    return (ring->head - ring->tail);
+}
+
+size_t DRV_USART0_RxRingPeek(const uint8_t ** data)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+    uint32_t tail = ring->tail;
+    uint32_t used = ring->head - tail;
+    uint32_t offset = tail & ring->mask;
+    uint32_t untilWrap = (ring->mask + 1) - offset;
+
+    if(data == NULL)
+    {
+        return 0;
+    }
+
+    /* Only the part before the wrap is contiguous, the rest is returned by
+       the next call after this part has been consumed */
+    *data = &ring->buffer[offset];
+    return (used < untilWrap) ? used : untilWrap;
+}
+
+void DRV_USART0_RxRingConsume(size_t nBytes)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+    uint32_t tail = ring->tail;
+    uint32_t used = ring->head - tail;
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    bool interruptWasEnabled;
+#endif
+
+    if(nBytes > used)
+    {
+        nBytes = used;
+    }
+
+    /* Finish reading the data before handing the space back */
+    _DRV_USART_MEMORY_BARRIER();
+    ring->tail = tail + nBytes;
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    /* The receive tasks routine also drives RTS, keep it out */
+    interruptWasEnabled = SYS_INT_Disable();
+    _DRV_USART0_RtsUpdate(ring->head - ring->tail);
+    SYS_INT_Restore(interruptWasEnabled);
+#endif
+}
+
+void DRV_USART0_RxRingEventHandlerSet(const DRV_USART_RX_RING_EVENT_HANDLER eventHandler, const uintptr_t context)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+    bool interruptWasEnabled;
+
+    /* The receive tasks routine reads both fields, update them together */
+    interruptWasEnabled = SYS_INT_Disable();
+    ring->eventHandler = eventHandler;
+    ring->context = context;
+    SYS_INT_Restore(interruptWasEnabled);
+}
+
+void DRV_USART0_RxRingTasks(void)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+    bool interruptWasEnabled;
+    bool idle = false;
+
+    /* Bytes below the FIFO trigger level do not raise the receive
+       interrupt, collect them here. The receive tasks routine also runs
+       from the interrupt, keep it out while the FIFO is read. */
+    interruptWasEnabled = SYS_INT_Disable();
+
+    if(PLIB_USART_ReceiverDataIsAvailable(USART_ID_5))
+    {
+        _DRV_USART0_BufferQueueRxTasks();
+    }
+
+    if((ring->idlePending) && ((_CP0_GET_COUNT() - ring->lastRxCount) >= _DRV_USART_RX_IDLE_TICKS))
+    {
+        ring->idlePending = false;
+        idle = true;
+    }
+
+    SYS_INT_Restore(interruptWasEnabled);
+
+    if(idle && (ring->eventHandler != NULL))
+    {
+        ring->eventHandler(DRV_USART_RX_RING_EVENT_IDLE, DRV_USART0_RxRingCount(), ring->context);
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local functions
+// *****************************************************************************
+// *****************************************************************************
+
+void _DRV_USART0_RxRingInitialize(void)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+
+    ring->buffer       = gDrvUSART0RxRing;
+    ring->mask         = DRV_USART_RX_RING_SIZE_IDX0 - 1;
+    ring->head         = 0;
+    ring->tail         = 0;
+    ring->dropCount    = 0;
+    ring->lastRxCount  = 0;
+    ring->idlePending  = false;
+    ring->eventHandler = NULL;
+    ring->context      = (uintptr_t)NULL;
+}
+
+void _DRV_USART0_RxRingReceive(void)
+{
+    DRV_USART_RX_RING_OBJ *ring = &gDrvUSART0Obj.rxRing;
+    uint32_t head = ring->head;
+    uint32_t before = head - ring->tail;
+    uint32_t available;
+    bool lineComplete = false;
+    uint8_t data;
+
+    /* Empty the FIFO into the ring */
+    while(PLIB_USART_ReceiverDataIsAvailable(USART_ID_5))
+    {
+        data = PLIB_USART_ReceiverByteReceive(USART_ID_5);
+        _DRV_USART_STATS_ADD(rxBytes, 1);
+
+        if((head - ring->tail) > ring->mask)
+        {
+            /* The ring is full, the byte is lost */
+            ring->dropCount ++;
+            _DRV_USART_STATS_ADD(rxRingDropBytes, 1);
+            continue;
+        }
+
+        ring->buffer[head & ring->mask] = data;
+        head ++;
+
+        if(data == DRV_USART_RX_EOL_CHAR_IDX0)
+        {
+            lineComplete = true;
+        }
+    }
+
+    if(head == ring->head)
+    {
+        return;
+    }
+
+    /* Publish the new bytes only after they are stored */
+    _DRV_USART_MEMORY_BARRIER();
+    ring->head = head;
+    ring->lastRxCount = _CP0_GET_COUNT();
+    _DRV_USART_STATS_MAX(rxRingHighWater, head - ring->tail);
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    _DRV_USART0_RtsUpdate(head - ring->tail);
+#endif
+    ring->idlePending = true;
+
+    if(ring->eventHandler != NULL)
+    {
+        available = head - ring->tail;
+
+        if(lineComplete)
+        {
+            ring->eventHandler(DRV_USART_RX_RING_EVENT_LINE, available, ring->context);
+        }
+
+        /* Raised once each time the occupancy climbs past the watermark */
+        if((before < DRV_USART_RX_WATERMARK_IDX0) && (available >= DRV_USART_RX_WATERMARK_IDX0))
+        {
+            ring->eventHandler(DRV_USART_RX_RING_EVENT_WATERMARK, available, ring->context);
+        }
+    }
+}
+
+#endif /* DRV_USART_RX_RING_SUPPORT */
+
+/*******************************************************************************
+ End of File
+*/
@@ -0,0 +1,443 @@
+/*******************************************************************************
+  USART driver static implementation of the transmit ring.
+
+  Company:
+    BTC POWER.
+
+  File Name:
+    drv_usart_static_tx_ring.c
+
+  Summary:
+    Source code for the USART driver static transmit ring.
+
+  Description:
+    This file contains two statically sized single producer, single consumer
+    byte rings, the transmit lanes, that sit in front of the USART
+    transmitter. Clients copy their records into a lane and return
+    immediately; the transmit tasks routine drains the lanes into the hardware
+    FIFO whenever the transmit interrupt flag reports room, always serving the
+    high priority lane first.
+
+  Remarks:
+    The producer (task context) only writes the head index and the consumer
+    (transmit tasks routine) only writes the tail index. Both indices run
+    freely and are masked on access. Every record is stored behind a two byte
+    length header so the consumer only switches lanes between records.
+    DRV_USART0_TxLaneReserve hands out ring space to format a record in place.
+    When that space would wrap around, the rest of the ring is filled with a
+    pad record, marked by _DRV_USART_TX_RECORD_PAD, which the consumer skips.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+
+#if (DRV_USART_TX_RING_SUPPORT == true)
+
+#if ((DRV_USART_TX_RING_SIZE_IDX0 & (DRV_USART_TX_RING_SIZE_IDX0 - 1)) != 0)
+#error "DRV_USART_TX_RING_SIZE_IDX0 must be a power of two"
+#endif
+
+#if ((DRV_USART_TX_RING_HIGH_SIZE_IDX0 & (DRV_USART_TX_RING_HIGH_SIZE_IDX0 - 1)) != 0)
+#error "DRV_USART_TX_RING_HIGH_SIZE_IDX0 must be a power of two"
+#endif
+
+#if (DRV_USART_TX_RING_SIZE_IDX0 > 32768) || (DRV_USART_TX_RING_HIGH_SIZE_IDX0 > 32768)
+#error "A transmit ring holds at most 32 KB, record lengths have 15 bits"
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data
+// *****************************************************************************
+// *****************************************************************************
+
+extern DRV_USART_OBJ  gDrvUSART0Obj ;
+
+/* Lane storage */
+static uint8_t gDrvUSART0TxRingHigh[DRV_USART_TX_RING_HIGH_SIZE_IDX0];
+static uint8_t gDrvUSART0TxRingNormal[DRV_USART_TX_RING_SIZE_IDX0];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static void _DRV_USART0_TxRingCopy(DRV_USART_TX_RING_OBJ *ring, uint32_t index, const uint8_t * data, uint32_t nBytes)
+{
+    uint32_t offset = index & ring->mask;
+    uint32_t firstPart = (ring->mask + 1) - offset;
+
+    if(firstPart > nBytes)
+    {
+        firstPart = nBytes;
+    }
+
+    /* Copy in at most two parts, the second one after wrapping around */
+    memcpy(&ring->buffer[offset], data, firstPart);
+    memcpy(&ring->buffer[0], &data[firstPart], nBytes - firstPart);
+}
+
+static void _DRV_USART0_TxRingPublish(DRV_USART_TX_RING_OBJ *ring, uint32_t head)
+{
+    uint32_t used = head - ring->tail;
+
+    ring->recordCount ++;
+    if(used > ring->highWater)
+    {
+        ring->highWater = used;
+    }
+
+    /* The data must be in place before the consumer can see the new head */
+    _DRV_USART_MEMORY_BARRIER();
+    ring->head = head;
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+#if (DRV_USART_ISR_PROFILE == true)
+    if(!SYS_INT_SourceIsEnabled(INT_SOURCE_USART_5_TRANSMIT))
+    {
+        /* The flag is pending while the transmitter is idle, so the
+           interrupt is taken as soon as the source is enabled */
+        gDrvUSART0Obj.isrTriggerCount = _CP0_GET_COUNT();
+        gDrvUSART0Obj.isrTriggerArmed = true;
+    }
+#endif
+    /* Let the transmit interrupt drain the new record */
+    _DRV_USART_TX_SOURCE_ENABLE();
+#endif
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Instance 0 static driver functions
+// *****************************************************************************
+// *****************************************************************************
+
+size_t DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE lane, const void * source, const size_t nBytes)
+{
+    DRV_USART_SEGMENT segment;
+
+    segment.buffer = source;
+    segment.length = nBytes;
+
+    return DRV_USART0_TxLaneWriteV(lane, &segment, 1);
+}
+
+size_t DRV_USART0_TxLaneWriteV(DRV_USART_TX_LANE lane, const DRV_USART_SEGMENT * segments, const size_t count)
+{
+    DRV_USART_TX_RING_OBJ *ring;
+    uint8_t header[_DRV_USART_TX_RECORD_HEADER];
+    uint32_t head;
+    uint32_t used;
+    uint32_t needed;
+    uint32_t position;
+    size_t nBytes = 0;
+    size_t index;
+
+    if((segments == NULL) || (count == 0) || (lane >= DRV_USART_TX_LANES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: NULL segment list or invalid lane");
+        return 0;
+    }
+
+    for(index = 0; index < count; index ++)
+    {
+        if((segments[index].buffer == NULL) && (segments[index].length != 0))
+        {
+            SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: NULL data pointer");
+            return 0;
+        }
+
+        /* Stop adding up once the record is too long anyway, so the sum
+           cannot wrap */
+        if(nBytes <= _DRV_USART_TX_RECORD_MAX)
+        {
+            nBytes += segments[index].length;
+        }
+    }
+
+    if(nBytes == 0)
+    {
+        /* We don't have any data to write */
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: No data to write");
+        return 0;
+    }
+
+    ring = &gDrvUSART0Obj.txRing[lane];
+    head = ring->head;
+    used = head - ring->tail;
+    needed = nBytes + _DRV_USART_TX_RECORD_HEADER;
+
+    if((nBytes > _DRV_USART_TX_RECORD_MAX) || (needed > ((ring->mask + 1) - used)) ||
+       (ring->reserved != 0))
+    {
+        /* The record is accepted completely or not at all, so that a message
+           never reaches the wire truncated. An open reservation owns the
+           head until it is committed. */
+        ring->dropCount ++;
+        ring->dropBytes += nBytes;
+        return 0;
+    }
+
+    header[0] = (uint8_t)nBytes;
+    header[1] = (uint8_t)(nBytes >> 8);
+    _DRV_USART0_TxRingCopy(ring, head, header, _DRV_USART_TX_RECORD_HEADER);
+    position = head + _DRV_USART_TX_RECORD_HEADER;
+
+    /* The pieces go back to back behind the one header */
+    for(index = 0; index < count; index ++)
+    {
+        _DRV_USART0_TxRingCopy(ring, position, (const uint8_t *)segments[index].buffer, segments[index].length);
+        position += segments[index].length;
+    }
+
+    _DRV_USART0_TxRingPublish(ring, head + needed);
+
+    return nBytes;
+}
+
+void * DRV_USART0_TxLaneReserve(DRV_USART_TX_LANE lane, const size_t nBytes)
+{
+    DRV_USART_TX_RING_OBJ *ring;
+    uint8_t header[_DRV_USART_TX_RECORD_HEADER];
+    uint32_t head;
+    uint32_t size;
+    uint32_t pad = 0;
+
+    if((nBytes == 0) || (lane >= DRV_USART_TX_LANES_NUMBER))
+    {
+        SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: No data to reserve or invalid lane");
+        return NULL;
+    }
+
+    ring = &gDrvUSART0Obj.txRing[lane];
+    head = ring->head;
+    size = ring->mask + 1;
+
+    if(nBytes > (size - ((head + _DRV_USART_TX_RECORD_HEADER) & ring->mask)))
+    {
+        /* The data would wrap around. Fill the rest of the ring with a pad
+           record the transmit tasks routine skips, and start at offset 0. */
+        pad = size - (head & ring->mask);
+    }
+
+    if((ring->reserved != 0) || (nBytes > _DRV_USART_TX_RECORD_MAX) || (pad == 1) ||
+       ((pad + _DRV_USART_TX_RECORD_HEADER + nBytes) > (size - (head - ring->tail))))
+    {
+        ring->dropCount ++;
+        ring->dropBytes += nBytes;
+        return NULL;
+    }
+
+    if(pad != 0)
+    {
+        header[0] = (uint8_t)(pad - _DRV_USART_TX_RECORD_HEADER);
+        header[1] = (uint8_t)((_DRV_USART_TX_RECORD_PAD | (pad - _DRV_USART_TX_RECORD_HEADER)) >> 8);
+        _DRV_USART0_TxRingCopy(ring, head, header, _DRV_USART_TX_RECORD_HEADER);
+    }
+
+    /* Nothing is published yet, the consumer only sees the space once the
+       record is committed */
+    ring->reserveHead = head + pad;
+    ring->reserved = nBytes;
+
+    return &ring->buffer[(ring->reserveHead + _DRV_USART_TX_RECORD_HEADER) & ring->mask];
+}
+
+size_t DRV_USART0_TxLaneCommit(DRV_USART_TX_LANE lane, const size_t nBytes)
+{
+    DRV_USART_TX_RING_OBJ *ring;
+    uint8_t header[_DRV_USART_TX_RECORD_HEADER];
+    size_t reserved;
+
+    if(lane >= DRV_USART_TX_LANES_NUMBER)
+    {
+        return 0;
+    }
+
+    ring = &gDrvUSART0Obj.txRing[lane];
+    reserved = ring->reserved;
+    ring->reserved = 0;
+
+    if((nBytes == 0) || (nBytes > reserved))
+    {
+        /* Dropping the reservation leaves the head and the pad unpublished */
+        if(nBytes > reserved)
+        {
+            SYS_DEBUG_MESSAGE(SYS_ERROR_DEBUG, "\r\nUSART Driver: Commit exceeds the reservation");
+        }
+        return 0;
+    }
+
+    header[0] = (uint8_t)nBytes;
+    header[1] = (uint8_t)(nBytes >> 8);
+    _DRV_USART0_TxRingCopy(ring, ring->reserveHead, header, _DRV_USART_TX_RECORD_HEADER);
+
+    _DRV_USART0_TxRingPublish(ring, ring->reserveHead + _DRV_USART_TX_RECORD_HEADER + nBytes);
+
+    return nBytes;
+}
+
+size_t DRV_USART0_TxRingWrite(const void * source, const size_t nBytes)
+{
+    return DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE_NORMAL, source, nBytes);
+}
+
+bool DRV_USART0_TxRingIsEmpty(void)
+{
+    DRV_USART_TX_RING_OBJ *rings = gDrvUSART0Obj.txRing;
+
+    return ((gDrvUSART0Obj.txRecordRemaining == 0) &&
+            (rings[DRV_USART_TX_LANE_HIGH].head == rings[DRV_USART_TX_LANE_HIGH].tail) &&
+            (rings[DRV_USART_TX_LANE_NORMAL].head == rings[DRV_USART_TX_LANE_NORMAL].tail));
+}
+
+void DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE lane, DRV_USART_TX_RING_STATUS * status)
+{
+    DRV_USART_TX_RING_OBJ *ring;
+
+    if((status == NULL) || (lane >= DRV_USART_TX_LANES_NUMBER))
+    {
+        return;
+    }
+
+    ring = &gDrvUSART0Obj.txRing[lane];
+
+    status->size        = ring->mask + 1;
+    status->used        = ring->head - ring->tail;
+    status->highWater   = ring->highWater;
+    status->recordCount = ring->recordCount;
+    status->dropCount   = ring->dropCount;
+    status->dropBytes   = ring->dropBytes;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Local functions
+// *****************************************************************************
+// *****************************************************************************
+
+void _DRV_USART0_TxRingInitialize(void)
+{
+    DRV_USART_TX_RING_OBJ *ring;
+    uint32_t lane;
+
+    gDrvUSART0Obj.txRing[DRV_USART_TX_LANE_HIGH].buffer = gDrvUSART0TxRingHigh;
+    gDrvUSART0Obj.txRing[DRV_USART_TX_LANE_HIGH].mask = DRV_USART_TX_RING_HIGH_SIZE_IDX0 - 1;
+    gDrvUSART0Obj.txRing[DRV_USART_TX_LANE_NORMAL].buffer = gDrvUSART0TxRingNormal;
+    gDrvUSART0Obj.txRing[DRV_USART_TX_LANE_NORMAL].mask = DRV_USART_TX_RING_SIZE_IDX0 - 1;
+
+    for(lane = 0; lane < DRV_USART_TX_LANES_NUMBER; lane ++)
+    {
+        ring = &gDrvUSART0Obj.txRing[lane];
+        ring->head        = 0;
+        ring->tail        = 0;
+        ring->recordCount = 0;
+        ring->dropCount   = 0;
+        ring->dropBytes   = 0;
+        ring->highWater   = 0;
+        ring->reserveHead = 0;
+        ring->reserved    = 0;
+    }
+
+    gDrvUSART0Obj.txLaneActive = DRV_USART_TX_LANE_HIGH;
+    gDrvUSART0Obj.txRecordRemaining = 0;
+}
+
+void _DRV_USART0_TxRingTasks(uint32_t room)
+{
+    DRV_USART_OBJ *dObj = &gDrvUSART0Obj;
+    DRV_USART_TX_RING_OBJ *ring;
+    uint32_t remaining;
+    uint32_t tail;
+    uint32_t lane;
+
+    /* `room` is the free FIFO space reported by the caller, there is no
+       per byte buffer full check */
+    while(room != 0)
+    {
+        if(dObj->txRecordRemaining == 0)
+        {
+            /* Between records: pick the highest priority lane with data */
+            for(lane = 0; lane < DRV_USART_TX_LANES_NUMBER; lane ++)
+            {
+                if(dObj->txRing[lane].head != dObj->txRing[lane].tail)
+                {
+                    break;
+                }
+            }
+
+            /* All lanes are empty, or a queued buffer waits for the end
+               of the current record */
+            if((lane == DRV_USART_TX_LANES_NUMBER) || !_DRV_USART_QUEUE_IS_EMPTY(dObj->writeQueue))
+            {
+                break;
+            }
+
+            ring = &dObj->txRing[lane];
+            tail = ring->tail;
+            remaining = ring->buffer[tail & ring->mask] |
+                    ((uint32_t)ring->buffer[(tail + 1) & ring->mask] << 8);
+            tail += _DRV_USART_TX_RECORD_HEADER;
+
+            if((remaining & _DRV_USART_TX_RECORD_PAD) != 0)
+            {
+                /* Space a reservation left unused at the end of the ring */
+                ring->tail = tail + (remaining & _DRV_USART_TX_RECORD_MAX);
+                continue;
+            }
+
+            dObj->txRecordRemaining = remaining;
+            dObj->txLaneActive = (DRV_USART_TX_LANE)lane;
+            ring->tail = tail;
+        }
+
+        ring = &dObj->txRing[dObj->txLaneActive];
+        tail = ring->tail;
+        remaining = dObj->txRecordRemaining;
+
+        /* Fill up the FIFO with the current record until the FIFO
+           is full or the record is complete */
+        while((remaining != 0) && (room != 0))
+        {
+            PLIB_USART_TransmitterByteSend(USART_ID_5, ring->buffer[tail & ring->mask]);
+            tail ++;
+            remaining --;
+            room --;
+            _DRV_USART_STATS_ADD(txBytes, 1);
+        }
+
+        /* Hand the consumed space back to the producer */
+        dObj->txRecordRemaining = remaining;
+        ring->tail = tail;
+    }
+}
+
+#if (DRV_USART_INTERRUPT_MODE == true)
+void _DRV_USART0_TxRingInterruptUpdate(void)
+{
+    if(_DRV_USART_QUEUE_IS_EMPTY(gDrvUSART0Obj.writeQueue) && DRV_USART0_TxRingIsEmpty())
+    {
+        SYS_INT_SourceDisable(INT_SOURCE_USART_5_TRANSMIT);
+
+        /* A record published between the check and the disable has
+           already tried to enable the source, so enable it again. */
+        if(!DRV_USART0_TxRingIsEmpty())
+        {
+            _DRV_USART_TX_SOURCE_ENABLE();
+        }
+    }
+}
+#endif
+
+#endif /* DRV_USART_TX_RING_SUPPORT */
+
+/*******************************************************************************
+ End of File
+*/
@@ -112,6 +112,14 @@ void SYS_PORTS_Initialize(void)
     PLIB_PORTS_OpenDrainEnable(PORTS_ID_0, PORT_CHANNEL_G, SYS_PORT_G_ODC);
     PLIB_PORTS_Write( PORTS_ID_0, PORT_CHANNEL_G,  SYS_PORT_G_LAT);
 	PLIB_PORTS_DirectionOutputSet( PORTS_ID_0, PORT_CHANNEL_G,  SYS_PORT_G_TRIS ^ 0xFFFF);
+
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    /* USART5 handshake on port pins: RTS output, high (stop) until the
+       driver is initialized, and CTS input */
+    PLIB_PORTS_PinSet(PORTS_ID_0, DRV_USART_RTS_PORT_IDX0, DRV_USART_RTS_PIN_IDX0);
+    PLIB_PORTS_PinDirectionOutputSet(PORTS_ID_0, DRV_USART_RTS_PORT_IDX0, DRV_USART_RTS_PIN_IDX0);
+    PLIB_PORTS_PinDirectionInputSet(PORTS_ID_0, DRV_USART_CTS_PORT_IDX0, DRV_USART_CTS_PIN_IDX0);
+#endif
     
 }
 
@@ -130,10 +130,97 @@ extern "C" {
 */
 #define DRV_USART_INSTANCES_NUMBER                  1
 #define DRV_USART_CLIENTS_NUMBER                    1
-#define DRV_USART_INTERRUPT_MODE                    false
+#define DRV_USART_INTERRUPT_MODE                    true
 #define DRV_USART_BYTE_MODEL_SUPPORT                false
 #define DRV_USART_READ_WRITE_MODEL_SUPPORT          true
-#define DRV_USART_BUFFER_QUEUE_SUPPORT              false
+#define DRV_USART_BUFFER_QUEUE_SUPPORT              true
+
+/* Slots of the write and read queues of the buffer queue model, powers of
+   two up to 128. A full queue makes DRV_USART0_BufferAddRead/Write fail. */
+#define DRV_USART_XMIT_QUEUE_SIZE_IDX0              4
+#define DRV_USART_RCV_QUEUE_SIZE_IDX0               4
+
+/* USART5 baud rate. The divisor and BRGH are chosen at build time for the
+   smallest error against SYS_CLK_BUS_PERIPHERAL_1, and a rate that misses by
+   more than DRV_USART_BAUD_ERROR_MAX_IDX0 (hundredths of a percent) stops
+   the build. DRV_USART0_BaudSet applies the same limit at run time. At
+   80 MHz:
+       9600     BRGH 1  BRG 2082   +0.02 %
+       115200   BRGH 1  BRG 173    -0.22 %
+       230400   BRGH 1  BRG 86     -0.22 %
+       460800   BRGH 1  BRG 42     +0.94 %
+       921600   BRGH 1  BRG 21     -1.36 %
+       1000000  BRGH 0  BRG 4       0.00 %
+       1500000  BRGH 1  BRG 12     +2.56 %  (rejected)
+       2000000  BRGH 1  BRG 9       0.00 % */
+#define DRV_USART_BAUD_RATE_IDX0                    115200
+#define DRV_USART_BAUD_ERROR_MAX_IDX0               200
+
+/* Longest DRV_USART0_BaudSet waits for the data already handed to the
+   transmitter to leave at the old rate: a full DMA block at 9600 baud takes
+   267 ms. When it expires the rate is left unchanged. */
+#define DRV_USART_BAUD_SET_TIMEOUT_US_IDX0          300000
+
+/* USART5 interrupt priority (1 to 7) and subpriority (0 to 3). The vector
+   set up in SYS_Initialize and the ISR in system_interrupt.c both use them. */
+#define DRV_USART_INT_PRIORITY_IDX0                 1
+#define DRV_USART_INT_SUB_PRIORITY_IDX0             0
+
+/* Run the ISR on the shadow register set, which FSRSSEL assigns to
+   priority 7. Requires DRV_USART_INT_PRIORITY_IDX0 7. */
+#define DRV_USART_INT_SRS_IDX0                      false
+
+/* Traffic, error and high water counters, see DRV_USART0_StatsGet */
+#define DRV_USART_STATISTICS                        true
+
+/* Measure interrupt latency and ISR body time with the core timer */
+#define DRV_USART_ISR_PROFILE                       false
+
+/* RTS/CTS handshake on port pins, UART5 has no handshake pins of its own.
+   Both lines are active low. Transmission pauses while the host holds CTS
+   high; RTS goes high when the receive ring holds DRV_USART_RTS_OFF_IDX0
+   bytes and low again at DRV_USART_RTS_ON_IDX0. A PORTB pin must also be
+   set digital in SYS_PORT_AD1PCFG. An unconnected CTS reads high and
+   stops the transmitter. */
+#define DRV_USART_FLOW_CONTROL_IDX0                 false
+#define DRV_USART_CTS_PORT_IDX0                     PORT_CHANNEL_D
+#define DRV_USART_CTS_PIN_IDX0                      PORTS_BIT_POS_3
+#define DRV_USART_RTS_PORT_IDX0                     PORT_CHANNEL_D
+#define DRV_USART_RTS_PIN_IDX0                      PORTS_BIT_POS_4
+#define DRV_USART_RTS_OFF_IDX0                      224
+#define DRV_USART_RTS_ON_IDX0                       128
+
+/* Send the buffers of the write queue (UartWritePacket) with a DMA channel
+   paced by the UART5 transmit interrupt event instead of copying them into
+   the FIFO from the ISR. The channel vector runs at the UART5 priority.
+   Requires DRV_USART_INTERRUPT_MODE and DRV_USART_BUFFER_QUEUE_SUPPORT,
+   cannot be combined with DRV_USART_FLOW_CONTROL_IDX0. */
+#define DRV_USART_SUPPORT_TRANSMIT_DMA              true
+#define DRV_USART_XMIT_DMA_CH_IDX0                  DMA_CHANNEL_1
+#define DRV_USART_XMIT_DMA_INT_SRC_IDX0             INT_SOURCE_DMA_1
+#define DRV_USART_XMIT_DMA_INT_VECTOR_IDX0          INT_VECTOR_DMA1
+#define DRV_USART_XMIT_DMA_ISR_VECTOR_IDX0          _DMA_1_VECTOR
+
+/* Transmit rings drained by the transmit tasks routine, a normal lane and a
+   high priority lane that is always served first. Sizes must be powers of
+   two. A reservation is contiguous, so a lane must hold twice the largest
+   record reserved on it to always find room when empty. */
+#define DRV_USART_TX_RING_SUPPORT                   true
+#define DRV_USART_TX_RING_SIZE_IDX0                 1024
+#define DRV_USART_TX_RING_HIGH_SIZE_IDX0            512
+
+/* Receive ring filled from the receive interrupt. The interrupt fires at
+   the FIFO trigger level (USART_RECEIVE_FIFO_ONE_CHAR, _HALF_FULL or
+   _3B4FULL). The size must be a power of two. The event handler is called
+   when the ring holds DRV_USART_RX_WATERMARK_IDX0 bytes, when the end of
+   line character arrives and DRV_USART_RX_IDLE_US_IDX0 after the last
+   byte. */
+#define DRV_USART_RX_RING_SUPPORT                   true
+#define DRV_USART_RX_RING_SIZE_IDX0                 256
+#define DRV_USART_RX_FIFO_TRIGGER_IDX0              USART_RECEIVE_FIFO_HALF_FULL
+#define DRV_USART_RX_WATERMARK_IDX0                 192
+#define DRV_USART_RX_EOL_CHAR_IDX0                  '\n'
+#define DRV_USART_RX_IDLE_US_IDX0                   2000
 
 // *****************************************************************************
 // *****************************************************************************
@@ -156,6 +243,57 @@ extern "C" {
 
 /*** Application Instance 0 Configuration ***/
 
+/*** Debug Logging Configuration ***/
+/* When true the LOGGING_* macros send compact binary records instead of
+   formatted text. The format strings are kept in the non-loaded
+   .app_log_sites section and expanded on the host by LogDecoder. */
+#define APP_LOG_TOKENIZED                           false
+
+/* Lowest log level compiled into the image: 0 debug, 1 warning, 2 error,
+   3 none. LOGGING_* call sites below it compile to nothing. The command line
+   build can override it with -DLOG_LEVEL_MIN=<n>. */
+#ifndef LOG_LEVEL_MIN
+#define LOG_LEVEL_MIN                               0
+#endif
+
+/* Print the cycle cost of one LOGGING_* call per level after the banner */
+#define APP_LOG_PROFILE                             false
+
+/* Per call site rate limit: at most APP_LOG_RATE_BURST messages per
+   APP_LOG_RATE_WINDOW_MS (below 107000), the rest are counted and reported
+   as "last message repeated N times". */
+#define APP_LOG_RATE_LIMIT                          true
+#define APP_LOG_RATE_WINDOW_MS                      1000
+#define APP_LOG_RATE_BURST                          4
+
+/* Keep the last APP_LOG_PERSIST_SIZE bytes of log records in RAM that
+   survives a reset, and replay them before the start up banner. The size
+   must be a power of two. */
+#define APP_LOG_PERSIST                             true
+#define APP_LOG_PERSIST_SIZE                        2048U
+
+/* Lets a host move UART5 to a faster rate with BAUD=, see App_BaudLink.h. A
+   new rate not confirmed with BAUDACK within APP_BAUD_LINK_TIMEOUT_MS is
+   dropped for the previous one. */
+#define APP_BAUD_LINK                               true
+#define APP_BAUD_LINK_TIMEOUT_MS                    1000
+
+/*** Core Timer Configuration ***/
+/* Blocking HAL waits execute WAIT between polls instead of spinning. The
+   core timer compare interrupt wakes the CPU at the latest CORE_TIMER_YIELD_US
+   after it went idle, the driver interrupts usually wake it earlier. */
+#define CORE_TIMER_YIELD                            true
+#define CORE_TIMER_YIELD_US                         20U
+
+/*** UART Streaming Configuration ***/
+/* UartStreamTasks moves UART_STREAM_CHUNK bytes at a time into the normal
+   transmit lane and stops after UART_STREAM_BUDGET_US per SYS_Tasks pass. */
+#define UART_STREAM_CHUNK                           128U
+#define UART_STREAM_BUDGET_US                       200U
+
+/* Adds %f to AppFormat. Pulls in the floating point support library. */
+#define APP_FORMAT_FLOAT_SUPPORT                    false
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -132,6 +132,11 @@ void _general_exception_handler ( void )
     SYS_DEBUG_PRINT(SYS_ERROR_FATAL, "\n\rGeneral Exception %s (cause=%d, addr=%x).\n\r",
                     _cause_str, _excep_code, _excep_addr);
 
+#if (APP_LOG_PERSIST == true)
+    /* Replayed from the persistent log after the next reset */
+    AppLogPersistException(_excep_code, _excep_addr);
+#endif
+
     while (1)
     {
         SYS_DEBUG_BreakPoint();
@@ -151,6 +151,20 @@ void SYS_Initialize ( void* data )
 
     /* Initialize Drivers */
     sysObj.drvUsart0 = DRV_USART_Initialize(DRV_USART_INDEX_0, (SYS_MODULE_INIT *)NULL);
+#if (DRV_USART_INTERRUPT_MODE == true)
+    SYS_INT_VectorPrioritySet(INT_VECTOR_UART5, DRV_USART_INT_PRIORITY_LEVEL_IDX0);
+    SYS_INT_VectorSubprioritySet(INT_VECTOR_UART5, DRV_USART_INT_SUB_PRIORITY_LEVEL_IDX0);
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    /* Same priority as UART5, the two vectors share the write queue */
+    SYS_INT_VectorPrioritySet(DRV_USART_XMIT_DMA_INT_VECTOR_IDX0, DRV_USART_INT_PRIORITY_LEVEL_IDX0);
+    SYS_INT_VectorSubprioritySet(DRV_USART_XMIT_DMA_INT_VECTOR_IDX0, DRV_USART_INT_SUB_PRIORITY_LEVEL_IDX0);
+#endif
+#endif
+#if (CORE_TIMER_YIELD == true)
+    /* Lowest priority, it only ends the sleep of CoreTimerYield */
+    SYS_INT_VectorPrioritySet(INT_VECTOR_CT, INT_PRIORITY_LEVEL1);
+    SYS_INT_VectorSubprioritySet(INT_VECTOR_CT, INT_SUBPRIORITY_LEVEL0);
+#endif
 
     /* Initialize System Services */
     SYS_PORTS_Initialize();
@@ -163,6 +177,11 @@ void SYS_Initialize ( void* data )
     /* Enable Global Interrupts */
     SYS_INT_Enable();
 
+#if (APP_LOG_PERSIST == true)
+    /* Keep log records that survived the reset for replay */
+    AppLogPersistInitialize();
+#endif
+
     /* Initialize the Application */
     APP_Initialize();
 }
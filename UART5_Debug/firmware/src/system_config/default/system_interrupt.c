@@ -59,6 +59,8 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 // *****************************************************************************
 // *****************************************************************************
 
+#include <xc.h>
+#include <sys/attribs.h>
 #include "system/common/sys_common.h"
 #include "app.h"
 #include "system_definitions.h"
@@ -69,6 +71,36 @@ SUBSTITUTE GOODS, TECHNOLOGY, SERVICES, OR ANY CLAIMS BY THIRD PARTIES
 // *****************************************************************************
 // *****************************************************************************
 
+#if (DRV_USART_INTERRUPT_MODE == true)
+void __ISR(_UART_5_VECTOR, DRV_USART_ISR_IPL_IDX0) _IntHandlerDrvUsartInstance0(void)
+{
+#if (DRV_USART_ISR_PROFILE == true)
+    uint32_t entryCount = _CP0_GET_COUNT();
+#endif
+
+    DRV_USART0_TasksTransmit();
+    DRV_USART0_TasksError();
+    DRV_USART0_TasksReceive();
+
+#if (DRV_USART_ISR_PROFILE == true)
+    DRV_USART0_IsrProfileUpdate(entryCount, _CP0_GET_COUNT());
+#endif
+}
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+void __ISR(DRV_USART_XMIT_DMA_ISR_VECTOR_IDX0, DRV_USART_ISR_IPL_IDX0) _IntHandlerDrvUsartTransmitDmaInstance0(void)
+{
+    DRV_USART0_TasksTransmitDma();
+}
+#endif
+#endif
+
+#if (CORE_TIMER_YIELD == true)
+void __ISR(_CORE_TIMER_VECTOR, IPL1AUTO) _IntHandlerCoreTimer(void)
+{
+    CoreTimerWakeTasks();
+}
+#endif
  
 /*******************************************************************************
  End of File
@@ -74,11 +74,24 @@ void SYS_Tasks ( void )
     /* Maintain system services */
 
     /* Maintain Device Drivers */
+#if (DRV_USART_INTERRUPT_MODE == false)
+    /* In interrupt mode the USART tasks run from the UART5 vector */
     DRV_USART_TasksTransmit(sysObj.drvUsart0);
     DRV_USART_TasksError (sysObj.drvUsart0);
     DRV_USART_TasksReceive(sysObj.drvUsart0);
+#endif
+#if (DRV_USART_RX_RING_SUPPORT == true)
+    /* Collect bytes below the receive FIFO trigger level and report idle gaps */
+    DRV_USART0_RxRingTasks();
+#endif
+#if (DRV_USART_FLOW_CONTROL_IDX0 == true)
+    /* Resume transmission once the host asserts CTS again */
+    DRV_USART0_FlowControlTasks();
+#endif
 
     /* Maintain Middleware & Other Libraries */
+    /* Move the next chunks of a large UART5 transfer */
+    UartStreamTasks();
 
     /* Maintain the application's state machine. */
     APP_Tasks();
@@ -0,0 +1,582 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : BaudLink.cpp
+
+  Summary     : Host side of the UART5 baud rate negotiation.
+
+  Description : Moves the debug UART from the boot rate to a faster one with
+                the exchange implemented by App_BaudLink.c on the target:
+
+                  host  BAUD=<rate>        at the current rate
+                  target BAUD OK <rate>    both sides switch
+                  host  BAUDCHK            at the new rate
+                  target BAUDPAT <pattern> compared by the host
+                  host  BAUDACK
+                  target BAUDACK OK <rate>
+
+                When the pattern does not arrive intact the host returns to
+                the previous rate and polls with BAUD? until the target
+                reports it too; the target drops the trial on the first
+                garbled line or after its trial timeout. Log lines received
+                in between are ignored.
+
+                --simulate runs the same exchange against a stand-in for the
+                target on a pseudo terminal. The stand-in follows the rate
+                the host sets on its side of the terminal and garbles every
+                byte while the two rates differ, so a missed switch shows up
+                the same way as on a real link. --simulate-fail also garbles
+                everything above the boot rate, which exercises the fall back.
+
+                Build : g++ -std=c++17 -O2 -o BaudLink BaudLink.cpp
+                Usage : BaudLink [--from N] [--monitor] <device> <rate>
+                        BaudLink --simulate [--simulate-fail] <rate>
+                        --from is the rate the target is at (default 115200).
+                        --monitor copies the link to stdout after the switch,
+                        for example into LogDecoder.
+                Exit  : 0 switched, 1 usage or I/O error, 2 rate rejected,
+                        3 fell back to the previous rate.
+ */
+/* ************************************************************************** */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+
+/* Same as APP_BAUD_LINK_PATTERN and APP_BAUD_LINK_TIMEOUT_MS in the firmware */
+const char *const kPattern = "UUUU****~~~~0123456789ABCDEFabcdef";
+constexpr int kTrialTimeoutMs = 1000;
+
+constexpr int kReplyTimeoutMs = 500;
+constexpr int kSettleMs = 20;
+
+enum ExitCode
+{
+    kExitSwitched = 0,
+    kExitError = 1,
+    kExitRejected = 2,
+    kExitFellBack = 3,
+};
+
+struct RateEntry
+{
+    unsigned rate;
+    speed_t speed;
+};
+
+/* Rates the Linux termios interface can set without custom divisors */
+const RateEntry kRates[] = {
+    {9600, B9600},       {19200, B19200},     {38400, B38400},     {57600, B57600},
+    {115200, B115200},   {230400, B230400},   {460800, B460800},   {500000, B500000},
+    {576000, B576000},   {921600, B921600},   {1000000, B1000000}, {1152000, B1152000},
+    {1500000, B1500000}, {2000000, B2000000}, {2500000, B2500000}, {3000000, B3000000},
+};
+
+bool RateToSpeed(unsigned rate, speed_t &speed)
+{
+    for(const RateEntry &entry : kRates)
+    {
+        if(entry.rate == rate)
+        {
+            speed = entry.speed;
+            return true;
+        }
+    }
+    return false;
+}
+
+unsigned SpeedToRate(speed_t speed)
+{
+    for(const RateEntry &entry : kRates)
+    {
+        if(entry.speed == speed)
+        {
+            return entry.rate;
+        }
+    }
+    return 0;
+}
+
+long long NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Serial port in raw mode with line assembly on the receive side */
+class Port
+{
+public:
+    explicit Port(int fd) : fd_(fd) {}
+
+    bool SetRate(unsigned rate)
+    {
+        struct termios tio;
+        speed_t speed;
+
+        if(!RateToSpeed(rate, speed) || (tcgetattr(fd_, &tio) != 0))
+        {
+            return false;
+        }
+
+        /* Let queued output leave at the old rate and drop what arrived at it */
+        tcdrain(fd_);
+        cfmakeraw(&tio);
+        tio.c_cflag |= CLOCAL | CREAD;
+        tio.c_cc[VMIN] = 0;
+        tio.c_cc[VTIME] = 0;
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+        if(tcsetattr(fd_, TCSANOW, &tio) != 0)
+        {
+            return false;
+        }
+        tcflush(fd_, TCIFLUSH);
+        pending_.clear();
+        return true;
+    }
+
+    /* LF only, so no end of line character trails behind a rate switch */
+    bool WriteLine(const std::string &line)
+    {
+        const std::string text = line + "\n";
+        return write(fd_, text.data(), text.size()) == static_cast<ssize_t>(text.size());
+    }
+
+    /* Next non-empty line, false on timeout */
+    bool ReadLine(std::string &line, int timeoutMs)
+    {
+        const long long deadline = NowMs() + timeoutMs;
+
+        for(;;)
+        {
+            const size_t end = pending_.find_first_of("\r\n");
+            if(end != std::string::npos)
+            {
+                line = pending_.substr(0, end);
+                pending_.erase(0, end + 1);
+                if(!line.empty())
+                {
+                    return true;
+                }
+                continue;
+            }
+
+            const long long left = deadline - NowMs();
+            if(left <= 0)
+            {
+                return false;
+            }
+
+            struct pollfd pfd = {fd_, POLLIN, 0};
+            if(poll(&pfd, 1, static_cast<int>(left)) > 0)
+            {
+                char buffer[256];
+                const ssize_t count = read(fd_, buffer, sizeof(buffer));
+                if(count > 0)
+                {
+                    pending_.append(buffer, static_cast<size_t>(count));
+                }
+            }
+        }
+    }
+
+    /* Waits for a line starting with `prefix`, skipping log output */
+    bool Expect(const std::string &prefix, std::string &line, int timeoutMs)
+    {
+        const long long deadline = NowMs() + timeoutMs;
+        long long left;
+
+        while((left = deadline - NowMs()) > 0)
+        {
+            if(!ReadLine(line, static_cast<int>(left)))
+            {
+                return false;
+            }
+            if(line.compare(0, prefix.size(), prefix) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    int Fd() const { return fd_; }
+
+private:
+    int fd_;
+    std::string pending_;
+};
+
+/* Runs the exchange, the port is left at the rate both sides agreed on */
+int Negotiate(Port &port, unsigned from, unsigned to)
+{
+    std::string line;
+
+    if(!port.SetRate(from))
+    {
+        std::cerr << "cannot set " << from << " baud\n";
+        return kExitError;
+    }
+
+    port.WriteLine("BAUD=" + std::to_string(to));
+    if(!port.Expect("BAUD ", line, kReplyTimeoutMs) || (line != "BAUD OK " + std::to_string(to)))
+    {
+        std::cerr << "target rejected " << to << " baud" << (line.empty() ? "" : ": " + line) << "\n";
+        return kExitRejected;
+    }
+
+    /* The target switches once its reply has left the transmit ring */
+    if(!port.SetRate(to))
+    {
+        std::cerr << "cannot set " << to << " baud on the host\n";
+    }
+    else
+    {
+        usleep(kSettleMs * 1000);
+        port.WriteLine("BAUDCHK");
+        if(port.Expect("BAUDPAT ", line, kReplyTimeoutMs) && (line == std::string("BAUDPAT ") + kPattern))
+        {
+            port.WriteLine("BAUDACK");
+            if(port.Expect("BAUDACK OK ", line, kReplyTimeoutMs))
+            {
+                std::cerr << "link at " << to << " baud\n";
+                return kExitSwitched;
+            }
+        }
+    }
+
+    /* The target returns on a garbled line or after its trial timeout. Its
+       announcement may have been sent before the host switched back, so ask. */
+    std::cerr << to << " baud failed, falling back to " << from << "\n";
+    port.SetRate(from);
+    for(const long long deadline = NowMs() + kTrialTimeoutMs + kReplyTimeoutMs; NowMs() < deadline;)
+    {
+        port.WriteLine("BAUD?");
+        if(port.Expect("BAUD set=" + std::to_string(from) + " ", line, kReplyTimeoutMs / 2))
+        {
+            return kExitFellBack;
+        }
+    }
+    std::cerr << "target did not return to " << from << " baud\n";
+    return kExitFellBack;
+}
+
+/* Copies the link to stdout until the port closes */
+void Monitor(Port &port)
+{
+    char buffer[256];
+    ssize_t count;
+
+    for(;;)
+    {
+        struct pollfd pfd = {port.Fd(), POLLIN, 0};
+        if(poll(&pfd, 1, -1) < 0)
+        {
+            return;
+        }
+        count = read(port.Fd(), buffer, sizeof(buffer));
+        if(count <= 0)
+        {
+            return;
+        }
+        fwrite(buffer, 1, static_cast<size_t>(count), stdout);
+        fflush(stdout);
+    }
+}
+
+/* Target stand-in for --simulate, mirrors App_BaudLink.c */
+class StandIn
+{
+public:
+    StandIn(int master, unsigned bootRate, bool failHigh)
+        : master_(master), bootRate_(bootRate), rate_(bootRate), confirmed_(bootRate), failHigh_(failHigh)
+    {
+    }
+
+    void Run()
+    {
+        long long nextLog = NowMs();
+
+        for(;;)
+        {
+            struct pollfd pfd = {master_, POLLIN, 0};
+            if(poll(&pfd, 1, 10) > 0)
+            {
+                char buffer[256];
+                const ssize_t count = read(master_, buffer, sizeof(buffer));
+                if(count <= 0)
+                {
+                    return;
+                }
+                for(ssize_t index = 0; index < count; index++)
+                {
+                    Receive(Garble(buffer[index]));
+                }
+            }
+
+            if(trial_ && (NowMs() >= deadline_))
+            {
+                FallBack();
+            }
+
+            /* Background log traffic the host has to skip */
+            if(NowMs() >= nextLog)
+            {
+                Send("Hello Uart!");
+                nextLog = NowMs() + 200;
+            }
+        }
+    }
+
+private:
+    /* Rate the host has set on its side of the pseudo terminal */
+    unsigned HostRate() const
+    {
+        struct termios tio;
+        return (tcgetattr(master_, &tio) == 0) ? SpeedToRate(cfgetospeed(&tio)) : 0;
+    }
+
+    bool LinkBroken() const
+    {
+        return (HostRate() != rate_) || (failHigh_ && (rate_ > bootRate_));
+    }
+
+    char Garble(char byte) const
+    {
+        return LinkBroken() ? static_cast<char>(byte ^ 0x5A) : byte;
+    }
+
+    void Send(const std::string &text)
+    {
+        std::string out = "\r\n" + text + "\r\n";
+        for(char &byte : out)
+        {
+            byte = Garble(byte);
+        }
+        if(write(master_, out.data(), out.size()) < 0)
+        {
+            return;
+        }
+    }
+
+    void Receive(char byte)
+    {
+        if((byte == '\r') || (byte == '\n'))
+        {
+            if(!line_.empty())
+            {
+                Execute(line_);
+            }
+            line_.clear();
+        }
+        else if(line_.size() < 24)
+        {
+            line_ += byte;
+        }
+    }
+
+    void FallBack()
+    {
+        trial_ = false;
+        rate_ = confirmed_;
+        Send("BAUD FALLBACK " + std::to_string(rate_));
+    }
+
+    void Execute(const std::string &line)
+    {
+        if(line == "BAUDCHK")
+        {
+            Send(std::string("BAUDPAT ") + kPattern);
+        }
+        else if(line == "BAUDACK")
+        {
+            if(trial_)
+            {
+                trial_ = false;
+                confirmed_ = rate_;
+            }
+            Send("BAUDACK OK " + std::to_string(confirmed_));
+        }
+        else if(trial_)
+        {
+            FallBack();
+        }
+        else if(line == "BAUD?")
+        {
+            Send("BAUD set=" + std::to_string(rate_) + " actual=" + std::to_string(rate_) + " err=+0.00% brgh=1 brg=0");
+        }
+        else if(line.compare(0, 5, "BAUD=") == 0)
+        {
+            speed_t speed;
+            char *end;
+            const unsigned long rate = std::strtoul(line.c_str() + 5, &end, 10);
+
+            if((*end != '\0') || !RateToSpeed(static_cast<unsigned>(rate), speed))
+            {
+                Send("BAUD ERR");
+                return;
+            }
+            Send("BAUD OK " + std::to_string(rate));
+            confirmed_ = rate_;
+            rate_ = static_cast<unsigned>(rate);
+            trial_ = true;
+            deadline_ = NowMs() + kTrialTimeoutMs;
+        }
+    }
+
+    int master_;
+    unsigned bootRate_;
+    unsigned rate_;
+    unsigned confirmed_;
+    bool failHigh_;
+    bool trial_ = false;
+    long long deadline_ = 0;
+    std::string line_;
+};
+
+int Simulate(unsigned from, unsigned to, bool failHigh)
+{
+    const int master = posix_openpt(O_RDWR | O_NOCTTY);
+    struct termios tio;
+    speed_t speed;
+
+    if((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+    {
+        std::cerr << "cannot create a pseudo terminal\n";
+        return kExitError;
+    }
+
+    const int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if((slave < 0) || (tcgetattr(slave, &tio) != 0) || !RateToSpeed(from, speed))
+    {
+        std::cerr << "cannot open the pseudo terminal\n";
+        return kExitError;
+    }
+
+    /* Both ends start at the boot rate */
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, speed);
+    cfsetospeed(&tio, speed);
+    tcsetattr(slave, TCSANOW, &tio);
+
+    const pid_t child = fork();
+    if(child == 0)
+    {
+        close(slave);
+        StandIn(master, from, failHigh).Run();
+        _exit(0);
+    }
+
+    Port port(slave);
+    const int result = Negotiate(port, from, to);
+
+    kill(child, SIGTERM);
+    waitpid(child, nullptr, 0);
+    close(slave);
+    close(master);
+    return result;
+}
+
+void Usage()
+{
+    std::cerr << "usage: BaudLink [--from N] [--monitor] <device> <rate>\n"
+                 "       BaudLink --simulate [--simulate-fail] [--from N] <rate>\n";
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    unsigned from = 115200;
+    bool monitor = false;
+    bool simulate = false;
+    bool failHigh = false;
+    std::string device;
+    unsigned to = 0;
+    int arg = 1;
+    speed_t speed;
+
+    for(; (arg < argc) && (std::strncmp(argv[arg], "--", 2) == 0); arg++)
+    {
+        if((std::strcmp(argv[arg], "--from") == 0) && (arg + 1 < argc))
+        {
+            from = static_cast<unsigned>(std::strtoul(argv[++arg], nullptr, 10));
+        }
+        else if(std::strcmp(argv[arg], "--monitor") == 0)
+        {
+            monitor = true;
+        }
+        else if(std::strcmp(argv[arg], "--simulate") == 0)
+        {
+            simulate = true;
+        }
+        else if(std::strcmp(argv[arg], "--simulate-fail") == 0)
+        {
+            simulate = true;
+            failHigh = true;
+        }
+        else
+        {
+            Usage();
+            return kExitError;
+        }
+    }
+
+    if(!simulate && (arg < argc))
+    {
+        device = argv[arg++];
+    }
+    if((arg + 1 != argc) || (!simulate && device.empty()))
+    {
+        Usage();
+        return kExitError;
+    }
+    to = static_cast<unsigned>(std::strtoul(argv[arg], nullptr, 10));
+
+    if(!RateToSpeed(from, speed) || !RateToSpeed(to, speed))
+    {
+        std::cerr << "unsupported rate, see kRates\n";
+        return kExitError;
+    }
+
+    if(simulate)
+    {
+        return Simulate(from, to, failHigh);
+    }
+
+    const int fd = open(device.c_str(), O_RDWR | O_NOCTTY);
+    if(fd < 0)
+    {
+        std::perror(device.c_str());
+        return kExitError;
+    }
+
+    Port port(fd);
+    const int result = Negotiate(port, from, to);
+    if(monitor && (result != kExitError))
+    {
+        Monitor(port);
+    }
+    close(fd);
+    return result;
+}
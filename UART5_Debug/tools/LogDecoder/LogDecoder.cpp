@@ -0,0 +1,372 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : LogDecoder.cpp
+
+  Summary     : Host side decoder for the tokenized UART log stream.
+
+  Description : Reads the `.app_log_sites` section of the firmware ELF file and
+                expands the binary records sent by the LOGGING_* macros in
+                tokenized mode back to text. Bytes that are not part of a record
+                (plain AppDebugPrint output) are passed through unchanged.
+
+                Record layout:
+                  0xA5 | length | varint(site id) | varint(delta) | varint(arg)...
+
+                The delta is the number of core timer ticks since the previous
+                record. Deltas are added up and printed as microseconds since
+                reset, together with the gap to the previous record. Text mode
+                records carry the same delta as a "[+ticks]" prefix, which is
+                converted the same way.
+
+                Build : g++ -std=c++17 -O2 -o LogDecoder LogDecoder.cpp
+                Usage : LogDecoder [--core-hz N] <firmware.elf> [capture.bin]
+                        The capture is read from stdin when no file is given.
+                        --core-hz is the core timer rate, half the system
+                        clock (default 40000000).
+ */
+/* ************************************************************************** */
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr uint8_t kRecordSync = 0xA5;
+constexpr size_t kRecordPayloadMax = 62;
+constexpr char kFieldSep = '\x1F';
+const char *const kSiteSection = ".app_log_sites";
+const char *const kLevelNames[] = {"DEBUG", "WARNING", "ERROR"};
+
+/* Core timer rate and running time since reset, in ticks */
+struct Clock
+{
+    double hz = 40000000.0;
+    uint64_t ticks = 0;
+};
+
+/* Call site table loaded from the ELF file */
+struct SiteTable
+{
+    uint32_t address = 0;
+    std::vector<char> data;
+};
+
+/* One call site string split into its fields */
+struct Site
+{
+    unsigned level = 0;
+    std::string file;
+    std::string line;
+    std::string format;
+};
+
+template <typename T>
+T ReadLe(const std::vector<uint8_t> &image, size_t offset)
+{
+    T value = 0;
+    for(size_t i = 0; i < sizeof(T); i++)
+    {
+        value |= static_cast<T>(image.at(offset + i)) << (8 * i);
+    }
+    return value;
+}
+
+/* PIC32 images are 32-bit little endian ELF files */
+bool LoadSiteTable(const std::string &path, SiteTable &table)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if((image.size() < 52) || (std::memcmp(image.data(), "\x7F" "ELF", 4) != 0) || (image[4] != 1) || (image[5] != 1))
+    {
+        std::cerr << path << ": not a 32-bit little endian ELF file\n";
+        return false;
+    }
+
+    const uint32_t shoff = ReadLe<uint32_t>(image, 32);
+    const uint16_t shentsize = ReadLe<uint16_t>(image, 46);
+    const uint16_t shnum = ReadLe<uint16_t>(image, 48);
+    const uint16_t shstrndx = ReadLe<uint16_t>(image, 50);
+    const uint32_t strOffset = ReadLe<uint32_t>(image, shoff + shstrndx * shentsize + 16);
+
+    for(uint16_t index = 0; index < shnum; index++)
+    {
+        const size_t header = shoff + index * shentsize;
+        const char *name = reinterpret_cast<const char *>(&image.at(strOffset + ReadLe<uint32_t>(image, header)));
+
+        if(std::strcmp(name, kSiteSection) == 0)
+        {
+            const uint32_t offset = ReadLe<uint32_t>(image, header + 16);
+            const uint32_t size = ReadLe<uint32_t>(image, header + 20);
+
+            table.address = ReadLe<uint32_t>(image, header + 12);
+            table.data.assign(image.begin() + offset, image.begin() + offset + size);
+            return true;
+        }
+    }
+
+    /* Text mode images have no call site table, their time stamps are still converted */
+    std::cerr << path << ": no " << kSiteSection << " section, decoding text mode records only\n";
+    return true;
+}
+
+bool LookupSite(const SiteTable &table, uint32_t siteId, Site &site)
+{
+    if((siteId < table.address) || (siteId >= table.address + table.data.size()))
+    {
+        return false;
+    }
+
+    const std::string text(&table.data[siteId - table.address]);
+    const size_t sep1 = text.find(kFieldSep);
+    const size_t sep2 = text.find(kFieldSep, sep1 + 1);
+    const size_t sep3 = text.find(kFieldSep, sep2 + 1);
+
+    if(sep3 == std::string::npos)
+    {
+        return false;
+    }
+
+    site.level = static_cast<unsigned>(std::stoul(text.substr(0, sep1)));
+    site.file = text.substr(sep1 + 1, sep2 - sep1 - 1);
+    site.line = text.substr(sep2 + 1, sep3 - sep2 - 1);
+    site.format = text.substr(sep3 + 1);
+    return true;
+}
+
+template <typename T>
+bool ReadVarint(const uint8_t *&cursor, const uint8_t *end, T &value)
+{
+    value = 0;
+    for(unsigned shift = 0; (cursor < end) && (shift < 8 * sizeof(T) + 7); shift += 7)
+    {
+        const uint8_t byte = *cursor++;
+        value |= static_cast<T>(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* printf style expansion where every argument is a 32-bit word */
+std::string Expand(const std::string &format, const std::vector<uint32_t> &args)
+{
+    std::string out;
+    size_t argIndex = 0;
+
+    for(size_t i = 0; i < format.size(); i++)
+    {
+        if(format[i] != '%')
+        {
+            out += format[i];
+            continue;
+        }
+
+        const size_t start = i++;
+        while((i < format.size()) && std::strchr("-+ #0123456789.lhz", format[i]))
+        {
+            i++;
+        }
+        if(i >= format.size())
+        {
+            break;
+        }
+
+        const char conversion = format[i];
+        if(conversion == '%')
+        {
+            out += '%';
+            continue;
+        }
+
+        std::string spec;
+        for(size_t j = start; j < i; j++)
+        {
+            if(!std::strchr("lhz", format[j]))
+            {
+                spec += format[j];
+            }
+        }
+
+        const uint32_t value = (argIndex < args.size()) ? args[argIndex++] : 0;
+        char piece[64];
+
+        switch(conversion)
+        {
+            case 'd':
+            case 'i':
+                std::snprintf(piece, sizeof(piece), (spec + "d").c_str(), static_cast<int32_t>(value));
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                std::snprintf(piece, sizeof(piece), (spec + conversion).c_str(), value);
+                break;
+            case 'c':
+                std::snprintf(piece, sizeof(piece), (spec + "c").c_str(), static_cast<int>(value));
+                break;
+            case 'p':
+                std::snprintf(piece, sizeof(piece), "0x%08x", value);
+                break;
+            default:
+                /* Strings and floats are not sent in tokenized mode */
+                std::snprintf(piece, sizeof(piece), "<%%%c:0x%08x>", conversion, value);
+                break;
+        }
+        out += piece;
+    }
+    return out;
+}
+
+/* Advances the clock by `delta` ticks and returns "[time us +gap us]" */
+std::string Stamp(Clock &clock, uint64_t delta)
+{
+    char text[64];
+
+    clock.ticks += delta;
+    std::snprintf(text, sizeof(text), "[%.3f us +%.3f us]",
+                  clock.ticks * 1e6 / clock.hz, delta * 1e6 / clock.hz);
+    return text;
+}
+
+void PrintRecord(const SiteTable &table, Clock &clock, const uint8_t *payload, size_t length)
+{
+    const uint8_t *cursor = payload;
+    const uint8_t *end = payload + length;
+    uint32_t siteId = 0;
+    uint64_t delta = 0;
+    std::vector<uint32_t> args;
+    Site site;
+
+    ReadVarint(cursor, end, siteId);
+    ReadVarint(cursor, end, delta);
+    for(uint32_t value = 0; (cursor < end) && ReadVarint(cursor, end, value);)
+    {
+        args.push_back(value);
+    }
+
+    LookupSite(table, siteId, site);
+    std::cout << "\n" << Stamp(clock, delta) << ' '
+              << ((site.level < 3) ? kLevelNames[site.level] : "?") << ' '
+              << site.file << ':' << site.line << ": "
+              << Expand(site.format, args) << '\n';
+}
+
+/* A record is accepted only when its length is plausible and its site id is known */
+bool IsRecord(const SiteTable &table, const std::vector<uint8_t> &stream, size_t pos)
+{
+    if((pos + 2 > stream.size()) || (stream[pos + 1] == 0) || (stream[pos + 1] > kRecordPayloadMax))
+    {
+        return false;
+    }
+    if(pos + 2 + stream[pos + 1] > stream.size())
+    {
+        return false;
+    }
+
+    const uint8_t *cursor = &stream[pos + 2];
+    uint32_t siteId = 0;
+    Site site;
+    return ReadVarint(cursor, cursor + stream[pos + 1], siteId) && LookupSite(table, siteId, site);
+}
+
+/* Length of a text mode "[+ticks]" prefix at `pos`, 0 if there is none */
+size_t TextStampLength(const std::vector<uint8_t> &stream, size_t pos, uint64_t &delta)
+{
+    size_t end = pos + 2;
+
+    if((pos + 3 > stream.size()) || (stream[pos] != '[') || (stream[pos + 1] != '+'))
+    {
+        return 0;
+    }
+
+    delta = 0;
+    while((end < stream.size()) && (end < pos + 22) && std::isdigit(stream[end]))
+    {
+        delta = (delta * 10) + (stream[end] - '0');
+        end++;
+    }
+    if((end == pos + 2) || (end >= stream.size()) || (stream[end] != ']'))
+    {
+        return 0;
+    }
+    return end + 1 - pos;
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    SiteTable table;
+    Clock clock;
+    int arg = 1;
+
+    if((argc > 2) && (std::strcmp(argv[1], "--core-hz") == 0))
+    {
+        clock.hz = std::strtod(argv[2], nullptr);
+        arg = 3;
+    }
+    if((argc - arg < 1) || (argc - arg > 2) || (clock.hz <= 0))
+    {
+        std::cerr << "usage: " << argv[0] << " [--core-hz N] <firmware.elf> [capture.bin]\n";
+        return 2;
+    }
+    if(!LoadSiteTable(argv[arg], table))
+    {
+        return 1;
+    }
+
+    std::ifstream file;
+    const bool fromFile = (argc - arg == 2);
+    if(fromFile)
+    {
+        file.open(argv[arg + 1], std::ios::binary);
+    }
+    std::istream &in = fromFile ? static_cast<std::istream &>(file) : std::cin;
+    const std::vector<uint8_t> stream((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    for(size_t pos = 0; pos < stream.size();)
+    {
+        uint64_t delta = 0;
+        size_t stampLength = 0;
+
+        if((stream[pos] == kRecordSync) && IsRecord(table, stream, pos))
+        {
+            PrintRecord(table, clock, &stream[pos + 2], stream[pos + 1]);
+            pos += 2 + stream[pos + 1];
+        }
+        else if((stampLength = TextStampLength(stream, pos, delta)) != 0)
+        {
+            std::cout << Stamp(clock, delta);
+            pos += stampLength;
+        }
+        else
+        {
+            std::cout.put(static_cast<char>(stream[pos]));
+            pos++;
+        }
+    }
+    return 0;
+}
+
+/* *****************************************************************************
+ End of File
+ */
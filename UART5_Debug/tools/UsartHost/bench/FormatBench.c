@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : FormatBench.c
+
+  Summary     : AppFormat against the C library sprintf on the host.
+
+  Description : Formats the conversions the firmware uses with both, checks
+                that the text is identical and prints the cost per call of
+                each. The process fails only when the text differs, the
+                timings are for reading. Code size is compared separately
+                by the FormatSize test, see CMakeLists.txt.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "HostBench.h"
+
+#define FORMAT_BENCH_SIZE       128U
+#define FORMAT_BENCH_CALLS      1000U
+#define FORMAT_BENCH_ROUNDS     200U
+
+/* Read through volatile so the compiler cannot format at build time */
+static volatile int benchMajor = 1;
+static volatile int benchMinor = 4;
+static volatile int benchPatch = 12;
+static volatile int benchLine = 412;
+static volatile int benchNegative = -42;
+static volatile int benchMinimum = INT32_MIN;
+static volatile unsigned benchCount = 42U;
+static volatile unsigned benchWord = 0xDEADBEEFU;
+static volatile unsigned benchNibble = 0x1FU;
+static volatile unsigned long benchBaud = 115200UL;
+static volatile unsigned long benchDelta = 123456789UL;
+static volatile char benchLetter = 'k';
+static const char * volatile benchName = "uart5";
+static const char * volatile benchLong = "truncate";
+
+static char appText[FORMAT_BENCH_SIZE];
+static char libcText[FORMAT_BENCH_SIZE];
+
+/* One conversion mix, formatted by AppFormat into appText and by sprintf
+   into libcText. %lu arguments are unsigned long for sprintf; AppFormat
+   reads 32 bits, which is the low half of the argument slot on this host. */
+#define FORMAT_BENCH_CASE(name, ...)                                        \
+    static void name##App(void)                                             \
+    {                                                                       \
+        AppFormat(appText, FORMAT_BENCH_SIZE, __VA_ARGS__);                 \
+    }                                                                       \
+    static void name##Libc(void)                                            \
+    {                                                                       \
+        sprintf(libcText, __VA_ARGS__);                                     \
+    }
+
+FORMAT_BENCH_CASE(Version, "   Firmware Version : %d.%d.%d\r\n", benchMajor, benchMinor, benchPatch)
+FORMAT_BENCH_CASE(Baud, "\r\nBAUD OK %lu\r\n", benchBaud)
+FORMAT_BENCH_CASE(Stamp, "\n\r[+%lu]", benchDelta)
+FORMAT_BENCH_CASE(Line, "():%d:", benchLine)
+FORMAT_BENCH_CASE(Signed, "%d %i", benchMinimum, benchNegative)
+FORMAT_BENCH_CASE(Hex, "%08X %x", benchWord, benchNibble)
+FORMAT_BENCH_CASE(Width, "%-12s|%5u|%c", benchName, benchCount, benchLetter)
+FORMAT_BENCH_CASE(Precision, "%.4s|%10s", benchLong, benchName)
+
+typedef struct
+{
+    const char *name;
+    HOST_BENCH_CALL app;
+    HOST_BENCH_CALL libc;
+} FORMAT_BENCH;
+
+static const FORMAT_BENCH formatBenches[] =
+{
+    { "version %d.%d.%d", VersionApp, VersionLibc },
+    { "baud %lu", BaudApp, BaudLibc },
+    { "stamp %lu", StampApp, StampLibc },
+    { "line %d", LineApp, LineLibc },
+    { "signed %d %i", SignedApp, SignedLibc },
+    { "hex %08X %x", HexApp, HexLibc },
+    { "width %-12s %5u %c", WidthApp, WidthLibc },
+    { "precision %.4s %10s", PrecisionApp, PrecisionLibc },
+};
+
+int main(void)
+{
+    const FORMAT_BENCH *bench;
+    double appCost;
+    double libcCost;
+    size_t index;
+    unsigned failed = 0U;
+
+    printf("%-22s %12s %12s %8s\n", "conversions", "AppFormat", "sprintf", "ratio");
+    printf("%-22s %12s %12s\n", "", hostBenchUnit, hostBenchUnit);
+
+    for(index = 0U; index < (sizeof(formatBenches) / sizeof(formatBenches[0])); index ++)
+    {
+        bench = &formatBenches[index];
+
+        bench->app();
+        bench->libc();
+        if(strcmp(appText, libcText) != 0)
+        {
+            printf("%s: AppFormat \"%s\", sprintf \"%s\"\n", bench->name, appText, libcText);
+            failed ++;
+            continue;
+        }
+
+        appCost = HostBenchPerCall(bench->app, FORMAT_BENCH_CALLS, FORMAT_BENCH_ROUNDS, NULL);
+        libcCost = HostBenchPerCall(bench->libc, FORMAT_BENCH_CALLS, FORMAT_BENCH_ROUNDS, NULL);
+        printf("%-22s %12.1f %12.1f %8.2f\n", bench->name, appCost, libcCost, libcCost / appCost);
+    }
+
+    printf("FormatBench: %u of %u outputs differ\n", failed,
+           (unsigned)(sizeof(formatBenches) / sizeof(formatBenches[0])));
+    return (failed == 0U) ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+# Prints the text size the formatter adds to a statically linked program.
+#
+#   cmake -DSIZE=<size> -DPLAIN=<probe> -DAPPFORMAT=<probe> -DSPRINTF=<probe> -P FormatSize.cmake
+#
+# The sprintf figure is what the host C library drags in (stdio, locale,
+# malloc). newlib on the PIC32 is smaller, so it shows the order of the cost
+# rather than the exact number on the target.
+
+function(probe_text file result)
+    execute_process(COMMAND ${SIZE} -B ${file} OUTPUT_VARIABLE output RESULT_VARIABLE status)
+    if(NOT status EQUAL 0)
+        message(FATAL_ERROR "${SIZE} failed on ${file}")
+    endif()
+    # Second line: text data bss dec hex filename
+    string(REGEX MATCH "\n[ \t]*([0-9]+)" line "${output}")
+    set(${result} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+probe_text(${PLAIN} plainText)
+probe_text(${APPFORMAT} appText)
+probe_text(${SPRINTF} sprintfText)
+
+math(EXPR appGrowth "${appText} - ${plainText}")
+math(EXPR sprintfGrowth "${sprintfText} - ${plainText}")
+
+message("text added by AppFormat: ${appGrowth} bytes")
+message("text added by sprintf:   ${sprintfGrowth} bytes")
+
+if(NOT appGrowth LESS sprintfGrowth)
+    message(FATAL_ERROR "AppFormat is not smaller than sprintf")
+endif()
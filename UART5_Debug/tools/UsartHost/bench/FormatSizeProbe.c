@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : FormatSizeProbe.c
+
+  Summary     : Smallest program that formats the firmware version line.
+
+  Description : Built three times, statically linked without the C library
+                start files: with FORMAT_SIZE_APPFORMAT, with
+                FORMAT_SIZE_SPRINTF and with neither. The host start files
+                already pull in the library's printf engine, so the probe
+                brings its own entry point and the image holds only what the
+                formatter needs. The probes are measured, never run, see
+                FormatSize.cmake.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#if defined(FORMAT_SIZE_APPFORMAT)
+#include "system_config.h"
+#include "system_definitions.h"
+#endif
+
+/* Volatile so the compiler cannot format at build time */
+static volatile int probeMajor = 1;
+
+static int FormatSizeProbe(void)
+{
+    char text[64];
+    int length;
+
+#if defined(FORMAT_SIZE_APPFORMAT)
+    length = AppFormat(text, sizeof(text), "   Firmware Version : %d.%d.%d\r\n", probeMajor, 4, 12);
+#elif defined(FORMAT_SIZE_SPRINTF)
+    length = sprintf(text, "   Firmware Version : %d.%d.%d\r\n", probeMajor, 4, 12);
+#else
+    /* Same work without a formatter */
+    text[0] = (char)probeMajor;
+    length = 1;
+#endif
+
+    return (int)text[0] + length;
+}
+
+void _start(void)
+{
+    probeMajor = FormatSizeProbe();
+
+    for(;;)
+    {
+    }
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : HostBench.c
+
+  Summary     : Call timing for the host benchmarks.
+
+  Description : See HostBench.h.
+ */
+/* ************************************************************************** */
+
+#include <stddef.h>
+#include <time.h>
+#include "HostBench.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+
+const char hostBenchUnit[] = "TSC ticks";
+
+uint64_t HostBenchNow(void)
+{
+    return __rdtsc();
+}
+
+#else
+
+const char hostBenchUnit[] = "ns";
+
+uint64_t HostBenchNow(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+
+#endif
+
+double HostBenchPerCall(HOST_BENCH_CALL call, uint32_t calls, uint32_t rounds, HOST_BENCH_CALL between)
+{
+    uint64_t best = UINT64_MAX;
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t round;
+    uint32_t index;
+
+    for(round = 0U; round < rounds; round ++)
+    {
+        start = HostBenchNow();
+        for(index = 0U; index < calls; index ++)
+        {
+            call();
+        }
+        elapsed = HostBenchNow() - start;
+
+        if(elapsed < best)
+        {
+            best = elapsed;
+        }
+        if(between != NULL)
+        {
+            between();
+        }
+    }
+
+    return (double)best / (double)calls;
+}
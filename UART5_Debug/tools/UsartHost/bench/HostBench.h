@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : HostBench.h
+
+  Summary     : Call timing for the host benchmarks.
+
+  Description : Times a function over rounds of calls and keeps the fastest
+                round, which is the figure least disturbed by the host
+                scheduler. On x86 the count is the time stamp counter, which
+                runs at the nominal clock of the CPU; elsewhere it is
+                nanoseconds. The figures compare two implementations on the
+                same host, they are not PIC32 cycles.
+ */
+/* ************************************************************************** */
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+#include <stdint.h>
+
+/* Work timed by HostBenchPerCall, and the untimed work between rounds */
+typedef void (*HOST_BENCH_CALL)(void);
+
+/* Unit of the figures HostBenchPerCall returns, for the report header */
+extern const char hostBenchUnit[];
+
+/* Current count of the benchmark clock */
+uint64_t HostBenchNow(void);
+
+/* Runs `call` `calls` times per round for `rounds` rounds, calling `between`
+   (when not NULL) outside the timed part after each round. Returns the
+   count per call of the fastest round. */
+double HostBenchPerCall(HOST_BENCH_CALL call, uint32_t calls, uint32_t rounds, HOST_BENCH_CALL between);
+
+#endif /* HOST_BENCH_H */
@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : LogTextBench.c
+
+  Summary     : AppLogText against the old LOGGING_PRE path on the host.
+
+  Description : Queues the same LOGGING_DEBUG records into the UART5 transmit
+                ring on the register model both ways: with AppLogText, which
+                formats once straight into the ring, and with a copy of the
+                LOGGING_PRE macro it replaced, which formats twice through
+                two stack buffers with sprintf and then runs strlen in
+                AppDebugPrint. Checks that both put the same text on the
+                wire, apart from the time stamp only AppLogText writes, and
+                prints the cost per call of each. The process fails only
+                when the text differs or a record is refused.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+#include "HostBench.h"
+
+/* Records per timed round, the transmit ring is drained between rounds */
+#define LOG_TEXT_BENCH_CALLS        4U
+#define LOG_TEXT_BENCH_ROUNDS       500U
+
+/* Call site both paths report */
+#define LOG_TEXT_BENCH_FUNCTION     "APP_Tasks"
+#define LOG_TEXT_BENCH_LINE         118
+
+/* LOGGING_DEBUG as it was before AppLogText, with the call site passed in
+   and char buffers instead of unsigned char */
+#define LEGACY_LOGGING_PRE                                  \
+    char uartData[MAX_MSG_BUFF_SIZE] = { };                 \
+    char uartData2[MAX_MSG_BUFF_SIZE] = { };
+
+#define LEGACY_LOGGING_DEBUG(function, line, ...)           \
+        {                                                   \
+            LEGACY_LOGGING_PRE;                             \
+            sprintf(uartData2, __VA_ARGS__);                \
+            sprintf(uartData, "\n\r%s():%d:%s%s%s",         \
+            function, line, DEBUG_COLOR_GREEN,              \
+            uartData2, DEBUG_COLOR_RESET);                  \
+            benchStatus |= AppDebugPrint(uartData);         \
+        }
+
+/* Read through volatile so the compiler cannot format at build time */
+static volatile int benchCount = 1234;
+static volatile unsigned benchElapsed = 250U;
+static volatile unsigned benchError = 0x1FU;
+static const char * volatile benchFrom = "IDLE";
+static const char * volatile benchTo = "SERVICE_TASKS";
+
+/* Any status other than SUCCESS from the timed calls */
+static int8_t benchStatus;
+
+static void LogTextBenchShortNew(void)
+{
+    benchStatus |= AppLogText(APP_LOG_LEVEL_DEBUG, DEBUG_COLOR_GREEN, LOG_TEXT_BENCH_FUNCTION,
+                              LOG_TEXT_BENCH_LINE, "heartbeat %d", benchCount);
+}
+
+static void LogTextBenchShortLegacy(void)
+{
+    LEGACY_LOGGING_DEBUG(LOG_TEXT_BENCH_FUNCTION, LOG_TEXT_BENCH_LINE, "heartbeat %d", benchCount);
+}
+
+static void LogTextBenchStateNew(void)
+{
+    benchStatus |= AppLogText(APP_LOG_LEVEL_DEBUG, DEBUG_COLOR_GREEN, LOG_TEXT_BENCH_FUNCTION,
+                              LOG_TEXT_BENCH_LINE, "state %s -> %s after %u ms, error 0x%X",
+                              benchFrom, benchTo, benchElapsed, benchError);
+}
+
+static void LogTextBenchStateLegacy(void)
+{
+    LEGACY_LOGGING_DEBUG(LOG_TEXT_BENCH_FUNCTION, LOG_TEXT_BENCH_LINE, "state %s -> %s after %u ms, error 0x%X",
+                         benchFrom, benchTo, benchElapsed, benchError);
+}
+
+typedef struct
+{
+    const char *name;
+    HOST_BENCH_CALL next;
+    HOST_BENCH_CALL legacy;
+} LOG_TEXT_BENCH;
+
+static const LOG_TEXT_BENCH logTextBenches[] =
+{
+    { "short message", LogTextBenchShortNew, LogTextBenchShortLegacy },
+    { "four conversions", LogTextBenchStateNew, LogTextBenchStateLegacy },
+};
+
+/* Sends what the last round queued, outside the timed part */
+static void LogTextBenchDrain(void)
+{
+    UsartHostRunUntilIdle(4000U);
+    usartHost.wireCount = 0U;
+}
+
+/* Text of one record as it left on the wire */
+static void LogTextBenchCapture(HOST_BENCH_CALL call, char *text, size_t size)
+{
+    size_t length;
+
+    LogTextBenchDrain();
+    call();
+    UsartHostRunUntilIdle(4000U);
+
+    length = (usartHost.wireCount < size) ? usartHost.wireCount : (size - 1U);
+    memcpy(text, usartHost.wire, length);
+    text[length] = '\0';
+}
+
+/* True when `next` is `legacy` with the "[+ticks]" stamp after the leading
+   "\n\r" */
+static bool LogTextBenchSame(const char *next, const char *legacy)
+{
+    const char *stampEnd = strchr(next, ']');
+
+    return (strncmp(next, "\n\r[+", 4U) == 0) && (stampEnd != NULL) &&
+           (strncmp(legacy, "\n\r", 2U) == 0) && (strcmp(stampEnd + 1, legacy + 2) == 0);
+}
+
+int main(void)
+{
+    static char nextText[512];
+    static char legacyText[512];
+    const LOG_TEXT_BENCH *bench;
+    double nextCost;
+    double legacyCost;
+    size_t index;
+    unsigned failed = 0U;
+
+    UsartHostReset();
+    DRV_USART0_Initialize();
+
+    printf("%-18s %12s %12s %8s\n", "record", "AppLogText", "LOGGING_PRE", "ratio");
+    printf("%-18s %12s %12s\n", "", hostBenchUnit, hostBenchUnit);
+
+    for(index = 0U; index < (sizeof(logTextBenches) / sizeof(logTextBenches[0])); index ++)
+    {
+        bench = &logTextBenches[index];
+        benchStatus = SUCCESS;
+
+        LogTextBenchCapture(bench->next, nextText, sizeof(nextText));
+        LogTextBenchCapture(bench->legacy, legacyText, sizeof(legacyText));
+        if(!LogTextBenchSame(nextText, legacyText))
+        {
+            printf("%s: AppLogText \"%s\", LOGGING_PRE \"%s\"\n", bench->name, nextText, legacyText);
+            failed ++;
+            continue;
+        }
+
+        LogTextBenchDrain();
+        nextCost = HostBenchPerCall(bench->next, LOG_TEXT_BENCH_CALLS, LOG_TEXT_BENCH_ROUNDS, LogTextBenchDrain);
+        legacyCost = HostBenchPerCall(bench->legacy, LOG_TEXT_BENCH_CALLS, LOG_TEXT_BENCH_ROUNDS, LogTextBenchDrain);
+        if(benchStatus != SUCCESS)
+        {
+            printf("%s: a record was refused\n", bench->name);
+            failed ++;
+            continue;
+        }
+        printf("%-18s %12.1f %12.1f %8.2f\n", bench->name, nextCost, legacyCost, legacyCost / nextCost);
+    }
+
+    printf("LogTextBench: %u of %u records failed\n", failed,
+           (unsigned)(sizeof(logTextBenches) / sizeof(logTextBenches[0])));
+    return (failed == 0U) ? 0 : 1;
+}
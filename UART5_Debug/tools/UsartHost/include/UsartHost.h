@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : UsartHost.h
+
+  Summary     : Register model of UART5 and DMA channel 1 for host tests.
+
+  Description : The model behaves like the PIC32MX795 parts the driver
+                depends on:
+                  - an 8 byte transmit FIFO. A byte written while it is full
+                    is lost and counted as an overrun.
+                  - latched interrupt flags. The UART5 transmit flag is set
+                    when the FIFO becomes empty and stays set until it is
+                    cleared, even after the FIFO has been filled again.
+                    Clearing it while the FIFO is empty has no effect, like
+                    the FIFO-empty interrupt mode.
+                  - a DMA channel with the 8 bit DCHxSSIZ register, 0 stands
+                    for 256 bytes, triggered by the transmit FIFO empty event.
+                  - a core timer that advances one byte time per step.
+                A pending and enabled interrupt is taken, in vector order, as
+                soon as the code under test enables its source or unmasks
+                interrupts, and after every step of UsartHostRun. Handlers
+                are not nested.
+ */
+/* ************************************************************************** */
+
+#ifndef USART_HOST_H
+#define USART_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Observations of the model since the last UsartHostReset */
+typedef struct
+{
+    /* Bytes that left the transmit shift register */
+    uint8_t wire[8192];
+    size_t wireCount;
+
+    /* Bytes written to a full transmit FIFO */
+    uint32_t txOverruns;
+
+    /* Blocks run by the DMA channel and the largest one */
+    uint32_t dmaBlocks;
+    uint32_t dmaBlockMax;
+
+    /* Transmit interrupt entries */
+    uint32_t txInterrupts;
+} USART_HOST_STATE;
+
+extern USART_HOST_STATE usartHost;
+
+/* Returns the peripherals to their reset state and clears usartHost */
+void UsartHostReset(void);
+
+/* Lets `steps` byte times pass, taking pending interrupts after each one */
+void UsartHostRun(uint32_t steps);
+
+/* Runs until the FIFO, the DMA channel and the transmit interrupt are idle,
+   at most `steps` byte times. Returns false when it did not get there. */
+bool UsartHostRunUntilIdle(uint32_t steps);
+
+/* Takes pending interrupts without moving time, unless masked or already
+   inside a handler */
+void UsartHostService(void);
+
+/* Bytes in the transmit FIFO */
+size_t UsartHostTxFifoCount(void);
+
+/* Moves the core timer count on by `ticks`, as if the CPU had been busy elsewhere */
+void UsartHostCoreTimerAdvance(uint32_t ticks);
+
+/* Records a failed check and returns the condition */
+bool UsartHostCheck(bool condition, const char *text, const char *file, int line);
+
+/* Prints the summary and returns the exit code of the test */
+int UsartHostResult(const char *name);
+
+#define HOST_CHECK(condition)       UsartHostCheck((condition), #condition, __FILE__, __LINE__)
+
+#endif /* USART_HOST_H */
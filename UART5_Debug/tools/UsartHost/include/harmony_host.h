@@ -0,0 +1,287 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : harmony_host.h
+
+  Summary     : Host stand-in for the Harmony v2 system services and PLIBs.
+
+  Description : Declares the Harmony types, constants and functions the
+                UART5 static driver uses, so its sources build unchanged
+                with the host compiler. Every Harmony header the firmware
+                includes maps to this file; the functions are implemented
+                by the register model in UsartHost.c.
+ */
+/* ************************************************************************** */
+
+#ifndef HARMONY_HOST_H
+#define HARMONY_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Section: System module                                                     */
+
+typedef enum { SYS_STATUS_ERROR = -1, SYS_STATUS_UNINITIALIZED = 0, SYS_STATUS_BUSY = 1, SYS_STATUS_READY = 2 } SYS_STATUS;
+typedef uintptr_t SYS_MODULE_OBJ;
+typedef unsigned short SYS_MODULE_INDEX;
+typedef struct { int value; } SYS_MODULE_INIT;
+#define SYS_MODULE_OBJ_INVALID      ((SYS_MODULE_OBJ)-1)
+
+typedef enum { SYS_ERROR_FATAL, SYS_ERROR_ERROR, SYS_ERROR_WARNING, SYS_ERROR_INFO, SYS_ERROR_DEBUG } SYS_ERROR_LEVEL;
+#define SYS_DEBUG_MESSAGE(level, message)
+#define SYS_DEBUG_PRINT(level, ...)
+#define SYS_DEBUG_BreakPoint()
+#define SYS_ASSERT(test, message)
+
+/* Section: USART driver types                                                */
+
+typedef uintptr_t DRV_HANDLE;
+#define DRV_HANDLE_INVALID          ((DRV_HANDLE)-1)
+typedef enum { DRV_IO_INTENT_READ = 1, DRV_IO_INTENT_WRITE = 2, DRV_IO_INTENT_READWRITE = 3 } DRV_IO_INTENT;
+#define DRV_USART_INDEX_0           0
+#define SYS_DEVCON_INDEX_0          0
+
+typedef enum
+{
+    DRV_USART_ERROR_NONE = 0,
+    DRV_USART_ERROR_RECEIVER_OVERRUN = 1,
+    DRV_USART_ERROR_PARITY = 2,
+    DRV_USART_ERROR_FRAMING = 4
+} DRV_USART_ERROR;
+
+typedef uintptr_t DRV_USART_BUFFER_HANDLE;
+#define DRV_USART_BUFFER_HANDLE_INVALID ((DRV_USART_BUFFER_HANDLE)-1)
+
+typedef enum
+{
+    DRV_USART_BUFFER_EVENT_COMPLETE,
+    DRV_USART_BUFFER_EVENT_ERROR,
+    DRV_USART_BUFFER_EVENT_ABORT
+} DRV_USART_BUFFER_EVENT;
+
+typedef void (*DRV_USART_BUFFER_EVENT_HANDLER)(DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE handle, uintptr_t context);
+
+typedef enum { DRV_USART_CLIENT_STATUS_READY, DRV_CLIENT_STATUS_ERROR } DRV_USART_CLIENT_STATUS;
+
+typedef enum
+{
+    DRV_USART_TRANSFER_STATUS_RECEIVER_DATA_PRESENT = 1,
+    DRV_USART_TRANSFER_STATUS_RECEIVER_EMPTY = 2,
+    DRV_USART_TRANSFER_STATUS_TRANSMIT_EMPTY = 4,
+    DRV_USART_TRANSFER_STATUS_TRANSMIT_FULL = 8
+} DRV_USART_TRANSFER_STATUS;
+
+typedef enum { DRV_USART_BAUD_SET_SUCCESS, DRV_USART_BAUD_SET_ERROR } DRV_USART_BAUD_SET_RESULT;
+typedef enum { DRV_USART_LINE_CONTROL_SET_SUCCESS, DRV_USART_LINE_CONTROL_SET_ERROR } DRV_USART_LINE_CONTROL_SET_RESULT;
+typedef enum { DRV_USART_LINE_CONTROL_8NONE1 } DRV_USART_LINE_CONTROL;
+#define DRV_USART_READ_ERROR        ((size_t)-1)
+#define DRV_USART_WRITE_ERROR       ((size_t)-1)
+
+SYS_MODULE_OBJ DRV_USART_Initialize(const SYS_MODULE_INDEX index, const SYS_MODULE_INIT * const init);
+void DRV_USART_TasksTransmit(SYS_MODULE_OBJ object);
+void DRV_USART_TasksReceive(SYS_MODULE_OBJ object);
+void DRV_USART_TasksError(SYS_MODULE_OBJ object);
+
+/* Section: Interrupt system service                                          */
+
+typedef enum
+{
+    INT_SOURCE_USART_5_ERROR,
+    INT_SOURCE_USART_5_RECEIVE,
+    INT_SOURCE_USART_5_TRANSMIT,
+    INT_SOURCE_DMA_0,
+    INT_SOURCE_DMA_1,
+    INT_SOURCE_DMA_2,
+    INT_SOURCE_DMA_3,
+    INT_SOURCE_TIMER_CORE,
+    INT_SOURCE_HOST_COUNT
+} INT_SOURCE;
+
+typedef enum { INT_VECTOR_UART5, INT_VECTOR_DMA0, INT_VECTOR_DMA1, INT_VECTOR_DMA2, INT_VECTOR_DMA3, INT_VECTOR_CT } INT_VECTOR;
+
+typedef enum
+{
+    INT_DISABLED, INT_PRIORITY_LEVEL1, INT_PRIORITY_LEVEL2, INT_PRIORITY_LEVEL3,
+    INT_PRIORITY_LEVEL4, INT_PRIORITY_LEVEL5, INT_PRIORITY_LEVEL6, INT_PRIORITY_LEVEL7
+} INT_PRIORITY_LEVEL;
+
+typedef enum { INT_SUBPRIORITY_LEVEL0, INT_SUBPRIORITY_LEVEL1, INT_SUBPRIORITY_LEVEL2, INT_SUBPRIORITY_LEVEL3 } INT_SUBPRIORITY_LEVEL;
+
+bool SYS_INT_SourceStatusGet(INT_SOURCE source);
+void SYS_INT_SourceStatusClear(INT_SOURCE source);
+void SYS_INT_SourceStatusSet(INT_SOURCE source);
+void SYS_INT_SourceEnable(INT_SOURCE source);
+bool SYS_INT_SourceDisable(INT_SOURCE source);
+bool SYS_INT_SourceIsEnabled(INT_SOURCE source);
+void SYS_INT_VectorPrioritySet(INT_VECTOR vector, INT_PRIORITY_LEVEL priority);
+void SYS_INT_VectorSubprioritySet(INT_VECTOR vector, INT_SUBPRIORITY_LEVEL subpriority);
+bool SYS_INT_Disable(void);
+void SYS_INT_Enable(void);
+void SYS_INT_Restore(bool state);
+bool SYS_INT_IsEnabled(void);
+void SYS_INT_Initialize(void);
+
+/* Section: Clock, device control and ports                                   */
+
+typedef enum { CLK_BUS_PERIPHERAL_1 = 1 } CLK_BUSES_PERIPHERAL;
+uint32_t SYS_CLK_PeripheralFrequencyGet(CLK_BUSES_PERIPHERAL bus);
+uint32_t SYS_CLK_SystemFrequencyGet(void);
+void SYS_CLK_Initialize(void *init);
+
+void SYS_DEVCON_Initialize(int index, SYS_MODULE_INIT *init);
+void SYS_DEVCON_PerformanceConfig(unsigned int sysclk);
+void SYS_DEVCON_JTAGDisable(void);
+
+typedef enum { PORTS_ID_0 } PORTS_MODULE_ID;
+typedef enum { PORT_CHANNEL_A, PORT_CHANNEL_B, PORT_CHANNEL_C, PORT_CHANNEL_D, PORT_CHANNEL_E, PORT_CHANNEL_F, PORT_CHANNEL_G } PORTS_CHANNEL;
+
+typedef enum
+{
+    PORTS_BIT_POS_0, PORTS_BIT_POS_1, PORTS_BIT_POS_2, PORTS_BIT_POS_3,
+    PORTS_BIT_POS_4, PORTS_BIT_POS_5, PORTS_BIT_POS_6, PORTS_BIT_POS_7,
+    PORTS_BIT_POS_8, PORTS_BIT_POS_9, PORTS_BIT_POS_10, PORTS_BIT_POS_11,
+    PORTS_BIT_POS_12, PORTS_BIT_POS_13, PORTS_BIT_POS_14, PORTS_BIT_POS_15
+} PORTS_BIT_POS;
+
+typedef uint32_t PORTS_DATA_TYPE;
+typedef uint32_t PORTS_DATA_MASK;
+typedef int SYS_PORTS_PIN_DIRECTION;
+typedef int PORTS_CHANGE_NOTICE_PIN;
+typedef int PORTS_PIN_MODE;
+typedef int PORTS_ANALOG_PIN;
+typedef int SYS_PORTS_PULLUP_PULLDOWN_STATUS;
+typedef int PORTS_REMAP_FUNCTION;
+typedef int PORTS_REMAP_INPUT_FUNCTION;
+typedef int PORTS_REMAP_INPUT_PIN;
+typedef int PORTS_REMAP_OUTPUT_FUNCTION;
+typedef int PORTS_REMAP_OUTPUT_PIN;
+typedef int PORTS_CHANGE_NOTICE_EDGE;
+typedef int PORTS_PIN_SLEW_RATE;
+typedef int PORTS_CHANGE_NOTICE_METHOD;
+#define PORTS_PIN_MODE_DIGITAL      1
+#define PORTS_PIN_DIRECTION_OUTPUT  1
+
+void SYS_PORTS_Initialize(void);
+bool SYS_PORTS_PinRead(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void SYS_PORTS_PinSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void SYS_PORTS_PinClear(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void SYS_PORTS_PinDirectionSelect(PORTS_MODULE_ID index, int direction, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+bool PLIB_PORTS_PinGet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinDirectionOutputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+void PLIB_PORTS_PinDirectionInputSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos);
+
+/* Section: USART peripheral library                                          */
+
+typedef enum { USART_ID_5 = 4 } USART_MODULE_ID;
+
+typedef enum
+{
+    USART_ERROR_NONE = 0,
+    USART_ERROR_RECEIVER_OVERRUN = 1,
+    USART_ERROR_FRAMING = 4,
+    USART_ERROR_PARITY = 8
+} USART_ERROR;
+
+typedef enum { USART_RECEIVE_FIFO_ONE_CHAR, USART_RECEIVE_FIFO_HALF_FULL, USART_RECEIVE_FIFO_3B4FULL } USART_RECEIVE_INTR_MODE;
+typedef enum { USART_TRANSMIT_FIFO_NOT_FULL, USART_TRANSMIT_FIFO_IDLE, USART_TRANSMIT_FIFO_EMPTY } USART_TRANSMIT_INTR_MODE;
+typedef enum { USART_ENABLE_TX_RX_USED } USART_OPERATION_MODE;
+
+void PLIB_USART_Enable(USART_MODULE_ID index);
+void PLIB_USART_Disable(USART_MODULE_ID index);
+void PLIB_USART_InitializeModeGeneral(USART_MODULE_ID index, bool autobaud, bool loopBack, bool wakeFromSleep, bool irdaMode, bool stopInIdle);
+void PLIB_USART_LineControlModeSelect(USART_MODULE_ID index, DRV_USART_LINE_CONTROL dataFlowConfig);
+void PLIB_USART_InitializeOperation(USART_MODULE_ID index, USART_RECEIVE_INTR_MODE receiveInterruptMode,
+        USART_TRANSMIT_INTR_MODE transmitInterruptMode, USART_OPERATION_MODE operationMode);
+void PLIB_USART_BaudSetAndEnable(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate);
+void PLIB_USART_BaudRateHighEnable(USART_MODULE_ID index);
+void PLIB_USART_BaudRateHighDisable(USART_MODULE_ID index);
+void PLIB_USART_BaudRateHighSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate);
+void PLIB_USART_BaudRateSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate);
+void PLIB_USART_BaudRateGeneratorSet(USART_MODULE_ID index, uint16_t baudRateGenerator);
+void PLIB_USART_TransmitterEnable(USART_MODULE_ID index);
+void PLIB_USART_TransmitterDisable(USART_MODULE_ID index);
+void PLIB_USART_ReceiverEnable(USART_MODULE_ID index);
+void PLIB_USART_ReceiverDisable(USART_MODULE_ID index);
+void PLIB_USART_ReceiverInterruptModeSelect(USART_MODULE_ID index, USART_RECEIVE_INTR_MODE interruptMode);
+void PLIB_USART_TransmitterInterruptModeSelect(USART_MODULE_ID index, USART_TRANSMIT_INTR_MODE fifolevel);
+bool PLIB_USART_ReceiverDataIsAvailable(USART_MODULE_ID index);
+uint8_t PLIB_USART_ReceiverByteReceive(USART_MODULE_ID index);
+bool PLIB_USART_TransmitterIsEmpty(USART_MODULE_ID index);
+bool PLIB_USART_TransmitterBufferIsFull(USART_MODULE_ID index);
+void PLIB_USART_TransmitterByteSend(USART_MODULE_ID index, uint8_t data);
+void * PLIB_USART_TransmitterAddressGet(USART_MODULE_ID index);
+USART_ERROR PLIB_USART_ErrorsGet(USART_MODULE_ID index);
+void PLIB_USART_ReceiverOverrunErrorClear(USART_MODULE_ID index);
+bool PLIB_USART_ModuleIsBusy(USART_MODULE_ID index);
+
+/* Section: DMA peripheral library                                            */
+
+typedef enum { DMA_ID_0 } DMA_MODULE_ID;
+typedef enum { DMA_CHANNEL_0, DMA_CHANNEL_1, DMA_CHANNEL_2, DMA_CHANNEL_3 } DMA_CHANNEL;
+typedef enum { DMA_INT_ADDRESS_ERROR = 1, DMA_INT_BLOCK_TRANSFER_COMPLETE = 8 } DMA_INT;
+typedef enum { DMA_TRIGGER_USART_5_TRANSMIT = 55 } DMA_TRIGGER_SOURCE;
+typedef enum { DMA_CHANNEL_PRIORITY_0, DMA_CHANNEL_PRIORITY_1, DMA_CHANNEL_PRIORITY_2, DMA_CHANNEL_PRIORITY_3 } DMA_CHANNEL_PRIORITY;
+typedef enum { DMA_CHANNEL_TRIGGER_TRANSFER_START } DMA_CHANNEL_TRIGGER_TYPE;
+
+void PLIB_DMA_Enable(DMA_MODULE_ID index);
+void PLIB_DMA_ChannelXEnable(DMA_MODULE_ID index, DMA_CHANNEL channel);
+void PLIB_DMA_ChannelXDisable(DMA_MODULE_ID index, DMA_CHANNEL channel);
+bool PLIB_DMA_ChannelXBusyIsBusy(DMA_MODULE_ID index, DMA_CHANNEL channel);
+void PLIB_DMA_ChannelXPrioritySelect(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_PRIORITY priority);
+void PLIB_DMA_ChannelXTriggerEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_TRIGGER_TYPE trigger);
+void PLIB_DMA_ChannelXStartIRQSet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_TRIGGER_SOURCE irq);
+void PLIB_DMA_ChannelXSourceStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint32_t address);
+void PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint32_t address);
+void PLIB_DMA_ChannelXSourceSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size);
+void PLIB_DMA_ChannelXDestinationSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size);
+void PLIB_DMA_ChannelXCellSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size);
+void PLIB_DMA_ChannelXINTSourceEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource);
+void PLIB_DMA_ChannelXINTSourceFlagClear(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource);
+bool PLIB_DMA_ChannelXINTSourceFlagGet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource);
+void PLIB_DMA_StartTransferSet(DMA_MODULE_ID index, DMA_CHANNEL channel);
+
+/* Section: Core registers and compiler intrinsics                            */
+
+unsigned int _CP0_GET_COUNT(void);
+void _CP0_SET_COMPARE(unsigned int compare);
+unsigned int _CP0_GET_CAUSE(void);
+unsigned int _CP0_GET_EPC(void);
+void _wait(void);
+void Nop(void);
+
+/* Host pointers do not fit the 32 bit physical address, the model keeps the
+   upper half of the last one converted, see UsartHost.c */
+uint32_t UsartHostKvaToPa(const volatile void *address);
+#define KVA_TO_PA(v)                UsartHostKvaToPa((const volatile void *)(v))
+
+extern volatile uint32_t RCON;
+extern volatile uint32_t RCONCLR;
+#define _RCON_POR_MASK              0x00000001u
+#define _RCON_BOR_MASK              0x00000002u
+#define _RCON_IDLE_MASK             0x00000004u
+#define _RCON_SLEEP_MASK            0x00000008u
+#define _RCON_WDTO_MASK             0x00000010u
+#define _RCON_SWR_MASK              0x00000040u
+#define _RCON_EXTR_MASK             0x00000080u
+#define _RCON_CMR_MASK              0x00000200u
+extern volatile unsigned int U5BRG;
+
+#define __ISR(vector, ipl)          __attribute__((used))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARMONY_HOST_H */
@@ -0,0 +1,2 @@
+/* Host stand-in, see harmony_host.h */
+#include "harmony_host.h"
@@ -0,0 +1,34 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : system_config.h
+
+  Summary     : Host build of the firmware system configuration.
+
+  Description : Takes the firmware system_config.h as it is and lets a test
+                target switch single driver or logging features with a
+                HOST_ define.
+ */
+/* ************************************************************************** */
+
+#ifndef USART_HOST_SYSTEM_CONFIG_H
+#define USART_HOST_SYSTEM_CONFIG_H
+
+#include_next "system_config.h"
+
+#ifdef HOST_SUPPORT_TRANSMIT_DMA
+#undef DRV_USART_SUPPORT_TRANSMIT_DMA
+#define DRV_USART_SUPPORT_TRANSMIT_DMA              HOST_SUPPORT_TRANSMIT_DMA
+#endif
+
+#ifdef HOST_APP_LOG_PERSIST
+#undef APP_LOG_PERSIST
+#define APP_LOG_PERSIST                             HOST_APP_LOG_PERSIST
+#endif
+
+#endif /* USART_HOST_SYSTEM_CONFIG_H */
@@ -0,0 +1,581 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : UsartHost.c
+
+  Summary     : Register model of UART5 and DMA channel 1 for host tests.
+
+  Description : Implements the Harmony functions declared in harmony_host.h
+                on top of the model described in UsartHost.h, and takes the
+                UART5 and DMA 1 interrupts the way system_interrupt.c does.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+/* Core timer ticks per 10 bit character at the configured rate */
+#define HOST_BYTE_TICKS     ((SYS_CLK_FREQ / 2UL) * 10UL / DRV_USART_BAUD_RATE_IDX0)
+
+/* Interrupt entries allowed per step before the model gives up on a source
+   that is never cleared */
+#define HOST_SERVICE_MAX    64
+
+USART_HOST_STATE usartHost;
+
+volatile uint32_t RCON;
+volatile uint32_t RCONCLR;
+volatile unsigned int U5BRG;
+
+/* Interrupt controller */
+static bool hostIfs[INT_SOURCE_HOST_COUNT];
+static bool hostIec[INT_SOURCE_HOST_COUNT];
+static bool hostIntEnabled;
+static bool hostInHandler;
+
+/* UART5 */
+static uint8_t hostTxFifo[8];
+static size_t hostTxCount;
+static volatile uint8_t hostTxReg;
+
+/* DMA channel 1 */
+static struct
+{
+    bool enabled;
+    bool triggerOnTx;
+    bool blockDoneEnabled;
+    bool blockDone;
+    uint8_t ssiz;
+    uint32_t sourcePa;
+    uint32_t pointer;
+} hostDma;
+
+/* Upper half of the host address space, see UsartHostKvaToPa */
+static uintptr_t hostKvaBase;
+
+static uint32_t hostCount;
+static uint32_t hostChecks;
+static uint32_t hostFailures;
+
+
+/* Section: Model                                                             */
+
+static void UsartHostTxPush(uint8_t data)
+{
+    if(hostTxCount >= sizeof(hostTxFifo))
+    {
+        usartHost.txOverruns ++;
+        return;
+    }
+    hostTxFifo[hostTxCount ++] = data;
+}
+
+static uint32_t UsartHostDmaBlockSize(void)
+{
+    return (hostDma.ssiz == 0U) ? 256U : hostDma.ssiz;
+}
+
+/* One transfer of the channel, one byte into UxTXREG */
+static void UsartHostDmaCell(void)
+{
+    const uint8_t *source;
+
+    if(!hostDma.enabled)
+    {
+        return;
+    }
+
+    source = (const uint8_t *)(hostKvaBase | hostDma.sourcePa);
+    UsartHostTxPush(source[hostDma.pointer ++]);
+
+    if(hostDma.pointer == UsartHostDmaBlockSize())
+    {
+        hostDma.enabled = false;
+        hostDma.blockDone = true;
+        if(hostDma.blockDoneEnabled)
+        {
+            hostIfs[INT_SOURCE_DMA_1] = true;
+        }
+    }
+}
+
+/* One byte time: the oldest byte leaves the FIFO */
+static void UsartHostShift(void)
+{
+    hostCount += HOST_BYTE_TICKS;
+
+    if(hostTxCount == 0U)
+    {
+        return;
+    }
+
+    if(usartHost.wireCount < sizeof(usartHost.wire))
+    {
+        usartHost.wire[usartHost.wireCount ++] = hostTxFifo[0];
+    }
+    memmove(&hostTxFifo[0], &hostTxFifo[1], -- hostTxCount);
+
+    if(hostTxCount == 0U)
+    {
+        /* The FIFO empty event latches the flag and paces the channel */
+        hostIfs[INT_SOURCE_USART_5_TRANSMIT] = true;
+        if(hostDma.triggerOnTx)
+        {
+            UsartHostDmaCell();
+        }
+    }
+}
+
+static bool UsartHostPending(INT_SOURCE source)
+{
+    return hostIfs[source] && hostIec[source];
+}
+
+void UsartHostService(void)
+{
+    uint32_t entries = 0U;
+
+    if(hostInHandler)
+    {
+        return;
+    }
+
+    hostInHandler = true;
+    while(hostIntEnabled && (entries < HOST_SERVICE_MAX))
+    {
+        entries ++;
+
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+        /* DMA 1 has the lower vector number, it goes first at equal priority */
+        if(UsartHostPending(DRV_USART_XMIT_DMA_INT_SRC_IDX0))
+        {
+            DRV_USART0_TasksTransmitDma();
+            continue;
+        }
+#endif
+        if(UsartHostPending(INT_SOURCE_USART_5_TRANSMIT) ||
+           UsartHostPending(INT_SOURCE_USART_5_RECEIVE) ||
+           UsartHostPending(INT_SOURCE_USART_5_ERROR))
+        {
+            if(UsartHostPending(INT_SOURCE_USART_5_TRANSMIT))
+            {
+                usartHost.txInterrupts ++;
+            }
+            DRV_USART0_TasksTransmit();
+            DRV_USART0_TasksError();
+            DRV_USART0_TasksReceive();
+            continue;
+        }
+        break;
+    }
+    hostInHandler = false;
+}
+
+void UsartHostReset(void)
+{
+    memset(&usartHost, 0, sizeof(usartHost));
+    memset(hostIfs, 0, sizeof(hostIfs));
+    memset(hostIec, 0, sizeof(hostIec));
+    memset(&hostDma, 0, sizeof(hostDma));
+    hostTxCount = 0U;
+    hostIntEnabled = true;
+    hostInHandler = false;
+
+    /* The FIFO is empty out of reset */
+    hostIfs[INT_SOURCE_USART_5_TRANSMIT] = true;
+}
+
+void UsartHostRun(uint32_t steps)
+{
+    while(steps != 0U)
+    {
+        UsartHostShift();
+        UsartHostService();
+        steps --;
+    }
+}
+
+bool UsartHostRunUntilIdle(uint32_t steps)
+{
+    while(steps != 0U)
+    {
+        if((hostTxCount == 0U) && !hostDma.enabled && !hostIec[INT_SOURCE_USART_5_TRANSMIT])
+        {
+            return true;
+        }
+        UsartHostRun(1U);
+        steps --;
+    }
+    return false;
+}
+
+size_t UsartHostTxFifoCount(void)
+{
+    return hostTxCount;
+}
+
+bool UsartHostCheck(bool condition, const char *text, const char *file, int line)
+{
+    hostChecks ++;
+    if(!condition)
+    {
+        hostFailures ++;
+        fprintf(stderr, "%s:%d: check failed: %s\n", file, line, text);
+    }
+    return condition;
+}
+
+int UsartHostResult(const char *name)
+{
+    printf("%s: %u checks, %u failed\n", name, (unsigned)hostChecks, (unsigned)hostFailures);
+    return (hostFailures == 0U) ? 0 : 1;
+}
+
+uint32_t UsartHostKvaToPa(const volatile void *address)
+{
+    hostKvaBase = (uintptr_t)address & ~(uintptr_t)0xFFFFFFFFu;
+    return (uint32_t)(uintptr_t)address;
+}
+
+
+/* Section: Interrupt system service                                          */
+
+bool SYS_INT_SourceStatusGet(INT_SOURCE source)
+{
+    return hostIfs[source];
+}
+
+void SYS_INT_SourceStatusClear(INT_SOURCE source)
+{
+    /* The FIFO empty condition sets the transmit flag again right away */
+    hostIfs[source] = (source == INT_SOURCE_USART_5_TRANSMIT) && (hostTxCount == 0U);
+}
+
+void SYS_INT_SourceStatusSet(INT_SOURCE source)
+{
+    hostIfs[source] = true;
+    UsartHostService();
+}
+
+void SYS_INT_SourceEnable(INT_SOURCE source)
+{
+    hostIec[source] = true;
+    UsartHostService();
+}
+
+bool SYS_INT_SourceDisable(INT_SOURCE source)
+{
+    bool wasEnabled = hostIec[source];
+
+    hostIec[source] = false;
+    return wasEnabled;
+}
+
+bool SYS_INT_SourceIsEnabled(INT_SOURCE source)
+{
+    return hostIec[source];
+}
+
+void SYS_INT_VectorPrioritySet(INT_VECTOR vector, INT_PRIORITY_LEVEL priority)
+{
+}
+
+void SYS_INT_VectorSubprioritySet(INT_VECTOR vector, INT_SUBPRIORITY_LEVEL subpriority)
+{
+}
+
+bool SYS_INT_Disable(void)
+{
+    bool wasEnabled = hostIntEnabled;
+
+    hostIntEnabled = false;
+    return wasEnabled;
+}
+
+void SYS_INT_Enable(void)
+{
+    hostIntEnabled = true;
+    UsartHostService();
+}
+
+void SYS_INT_Restore(bool state)
+{
+    hostIntEnabled = state;
+    UsartHostService();
+}
+
+bool SYS_INT_IsEnabled(void)
+{
+    return hostIntEnabled;
+}
+
+uint32_t SYS_CLK_PeripheralFrequencyGet(CLK_BUSES_PERIPHERAL bus)
+{
+    return SYS_CLK_BUS_PERIPHERAL_1;
+}
+
+uint32_t SYS_CLK_SystemFrequencyGet(void)
+{
+    return SYS_CLK_FREQ;
+}
+
+bool PLIB_PORTS_PinGet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+    /* CTS asserted */
+    return false;
+}
+
+void PLIB_PORTS_PinSet(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+}
+
+void PLIB_PORTS_PinClear(PORTS_MODULE_ID index, PORTS_CHANNEL channel, PORTS_BIT_POS bitPos)
+{
+}
+
+
+/* Section: USART peripheral library                                          */
+
+void PLIB_USART_Enable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_Disable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_InitializeModeGeneral(USART_MODULE_ID index, bool autobaud, bool loopBack, bool wakeFromSleep,
+        bool irdaMode, bool stopInIdle)
+{
+}
+
+void PLIB_USART_LineControlModeSelect(USART_MODULE_ID index, DRV_USART_LINE_CONTROL dataFlowConfig)
+{
+}
+
+void PLIB_USART_InitializeOperation(USART_MODULE_ID index, USART_RECEIVE_INTR_MODE receiveInterruptMode,
+        USART_TRANSMIT_INTR_MODE transmitInterruptMode, USART_OPERATION_MODE operationMode)
+{
+}
+
+void PLIB_USART_BaudSetAndEnable(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate)
+{
+}
+
+void PLIB_USART_BaudRateHighEnable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_BaudRateHighDisable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_BaudRateHighSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate)
+{
+}
+
+void PLIB_USART_BaudRateSet(USART_MODULE_ID index, uint32_t clockFrequency, uint32_t baudRate)
+{
+}
+
+void PLIB_USART_BaudRateGeneratorSet(USART_MODULE_ID index, uint16_t baudRateGenerator)
+{
+    U5BRG = baudRateGenerator;
+}
+
+void PLIB_USART_TransmitterEnable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_TransmitterDisable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_ReceiverEnable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_ReceiverDisable(USART_MODULE_ID index)
+{
+}
+
+void PLIB_USART_ReceiverInterruptModeSelect(USART_MODULE_ID index, USART_RECEIVE_INTR_MODE interruptMode)
+{
+}
+
+void PLIB_USART_TransmitterInterruptModeSelect(USART_MODULE_ID index, USART_TRANSMIT_INTR_MODE fifolevel)
+{
+}
+
+bool PLIB_USART_ReceiverDataIsAvailable(USART_MODULE_ID index)
+{
+    return false;
+}
+
+uint8_t PLIB_USART_ReceiverByteReceive(USART_MODULE_ID index)
+{
+    return 0U;
+}
+
+bool PLIB_USART_TransmitterIsEmpty(USART_MODULE_ID index)
+{
+    return (hostTxCount == 0U);
+}
+
+bool PLIB_USART_TransmitterBufferIsFull(USART_MODULE_ID index)
+{
+    return (hostTxCount >= sizeof(hostTxFifo));
+}
+
+void PLIB_USART_TransmitterByteSend(USART_MODULE_ID index, uint8_t data)
+{
+    UsartHostTxPush(data);
+}
+
+void * PLIB_USART_TransmitterAddressGet(USART_MODULE_ID index)
+{
+    return (void *)&hostTxReg;
+}
+
+USART_ERROR PLIB_USART_ErrorsGet(USART_MODULE_ID index)
+{
+    return USART_ERROR_NONE;
+}
+
+void PLIB_USART_ReceiverOverrunErrorClear(USART_MODULE_ID index)
+{
+}
+
+bool PLIB_USART_ModuleIsBusy(USART_MODULE_ID index)
+{
+    return (hostTxCount != 0U);
+}
+
+
+/* Section: DMA peripheral library                                            */
+
+void PLIB_DMA_Enable(DMA_MODULE_ID index)
+{
+}
+
+void PLIB_DMA_ChannelXEnable(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    hostDma.enabled = true;
+    hostDma.pointer = 0U;
+    usartHost.dmaBlocks ++;
+    if(UsartHostDmaBlockSize() > usartHost.dmaBlockMax)
+    {
+        usartHost.dmaBlockMax = UsartHostDmaBlockSize();
+    }
+}
+
+void PLIB_DMA_ChannelXDisable(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    hostDma.enabled = false;
+}
+
+bool PLIB_DMA_ChannelXBusyIsBusy(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    return hostDma.enabled;
+}
+
+void PLIB_DMA_ChannelXPrioritySelect(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_PRIORITY priority)
+{
+}
+
+void PLIB_DMA_ChannelXTriggerEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_CHANNEL_TRIGGER_TYPE trigger)
+{
+}
+
+void PLIB_DMA_ChannelXStartIRQSet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_TRIGGER_SOURCE irq)
+{
+    hostDma.triggerOnTx = (irq == DMA_TRIGGER_USART_5_TRANSMIT);
+}
+
+void PLIB_DMA_ChannelXSourceStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint32_t address)
+{
+    hostDma.sourcePa = address;
+}
+
+void PLIB_DMA_ChannelXDestinationStartAddressSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint32_t address)
+{
+}
+
+void PLIB_DMA_ChannelXSourceSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size)
+{
+    /* DCHxSSIZ has 8 bits, the upper byte is not implemented */
+    hostDma.ssiz = (uint8_t)size;
+}
+
+void PLIB_DMA_ChannelXDestinationSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size)
+{
+}
+
+void PLIB_DMA_ChannelXCellSizeSet(DMA_MODULE_ID index, DMA_CHANNEL channel, uint16_t size)
+{
+}
+
+void PLIB_DMA_ChannelXINTSourceEnable(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource)
+{
+    if(dmaINTSource == DMA_INT_BLOCK_TRANSFER_COMPLETE)
+    {
+        hostDma.blockDoneEnabled = true;
+    }
+}
+
+void PLIB_DMA_ChannelXINTSourceFlagClear(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource)
+{
+    if(dmaINTSource == DMA_INT_BLOCK_TRANSFER_COMPLETE)
+    {
+        hostDma.blockDone = false;
+    }
+}
+
+bool PLIB_DMA_ChannelXINTSourceFlagGet(DMA_MODULE_ID index, DMA_CHANNEL channel, DMA_INT dmaINTSource)
+{
+    return (dmaINTSource == DMA_INT_BLOCK_TRANSFER_COMPLETE) && hostDma.blockDone;
+}
+
+void PLIB_DMA_StartTransferSet(DMA_MODULE_ID index, DMA_CHANNEL channel)
+{
+    UsartHostDmaCell();
+}
+
+
+/* Section: Core registers                                                    */
+
+void UsartHostCoreTimerAdvance(uint32_t ticks)
+{
+    hostCount += ticks;
+}
+
+unsigned int _CP0_GET_COUNT(void)
+{
+    /* Moves on a little with every read so polling loops end */
+    return ++ hostCount;
+}
+
+void _CP0_SET_COMPARE(unsigned int compare)
+{
+}
+
+void _wait(void)
+{
+    UsartHostRun(1U);
+}
+
+void Nop(void)
+{
+}
+
+/* *****************************************************************************
+ End of File
+ */
@@ -0,0 +1,220 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : BufferQueueTest.c
+
+  Summary     : Buffer queues of the UART5 driver on the register model.
+
+  Description : Checks the index ring write queue: a full queue refuses the
+                next buffer, buffers complete in order with their own
+                handles, the 8 bit head and tail indices wrap, a completion
+                handler can queue the next buffer from the interrupt, and
+                transmit ring records wait for queued buffers. Built once
+                with the CPU path and once with the DMA channel.
+ */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+#define BUFFER_QUEUE_TEST_EVENTS    512U
+
+static DRV_USART_BUFFER_HANDLE completed[BUFFER_QUEUE_TEST_EVENTS];
+static uint32_t completeEvents;
+static uint32_t otherEvents;
+
+/* Buffers the handler still queues from the interrupt */
+static uint32_t chainRemaining;
+static char chainBuffer[] = "chained from the completion handler\r\n";
+
+static void BufferQueueTestEvent(DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE handle, uintptr_t context)
+{
+    DRV_USART_BUFFER_HANDLE next;
+
+    if(event != DRV_USART_BUFFER_EVENT_COMPLETE)
+    {
+        otherEvents ++;
+        return;
+    }
+
+    if(completeEvents < BUFFER_QUEUE_TEST_EVENTS)
+    {
+        completed[completeEvents] = handle;
+    }
+    completeEvents ++;
+
+    if(chainRemaining != 0U)
+    {
+        chainRemaining --;
+        DRV_USART0_BufferAddWrite(&next, chainBuffer, sizeof(chainBuffer) - 1U);
+    }
+}
+
+static void BufferQueueTestStart(void)
+{
+    UsartHostReset();
+    DRV_USART0_Initialize();
+    DRV_USART0_BufferEventHandlerSet(BufferQueueTestEvent, 0U);
+    completeEvents = 0U;
+    otherEvents = 0U;
+    chainRemaining = 0U;
+}
+
+static void BufferQueueTestFull(void)
+{
+    static char buffers[DRV_USART_XMIT_QUEUE_SIZE_IDX0][24];
+    static uint8_t expected[sizeof(buffers)];
+    DRV_USART_BUFFER_HANDLE handles[DRV_USART_XMIT_QUEUE_SIZE_IDX0];
+    DRV_USART_BUFFER_HANDLE extra;
+    DRV_USART_STATS stats;
+    bool interruptState;
+    uint32_t index;
+
+    BufferQueueTestStart();
+
+    /* Nothing completes while interrupts are masked */
+    interruptState = SYS_INT_Disable();
+    for(index = 0U; index < DRV_USART_XMIT_QUEUE_SIZE_IDX0; index ++)
+    {
+        memset(buffers[index], 'a' + (int)index, sizeof(buffers[index]));
+        memcpy(&expected[index * sizeof(buffers[index])], buffers[index], sizeof(buffers[index]));
+        DRV_USART0_BufferAddWrite(&handles[index], buffers[index], sizeof(buffers[index]));
+        HOST_CHECK(handles[index] != DRV_USART_BUFFER_HANDLE_INVALID);
+        HOST_CHECK((index == 0U) || (handles[index] != handles[index - 1U]));
+    }
+    DRV_USART0_BufferAddWrite(&extra, buffers[0], sizeof(buffers[0]));
+    HOST_CHECK(extra == DRV_USART_BUFFER_HANDLE_INVALID);
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(UsartHostRunUntilIdle(2000U));
+    HOST_CHECK(usartHost.wireCount == sizeof(expected));
+    HOST_CHECK(memcmp(usartHost.wire, expected, sizeof(expected)) == 0);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(completeEvents == DRV_USART_XMIT_QUEUE_SIZE_IDX0);
+    HOST_CHECK(otherEvents == 0U);
+    for(index = 0U; index < DRV_USART_XMIT_QUEUE_SIZE_IDX0; index ++)
+    {
+        HOST_CHECK(completed[index] == handles[index]);
+    }
+
+    DRV_USART0_StatsGet(&stats);
+    HOST_CHECK(stats.writeQueueHighWater == DRV_USART_XMIT_QUEUE_SIZE_IDX0);
+
+    /* Room again once the queue has drained */
+    DRV_USART0_BufferAddWrite(&extra, buffers[0], sizeof(buffers[0]));
+    HOST_CHECK(extra != DRV_USART_BUFFER_HANDLE_INVALID);
+}
+
+static void BufferQueueTestWrap(void)
+{
+    static char buffers[3][12] = { "first  ...\r\n", "second ...\r\n", "third  ...\r\n" };
+    DRV_USART_BUFFER_HANDLE handles[3];
+    uint32_t round;
+    uint32_t index;
+    bool inOrder = true;
+    bool wireOk = true;
+
+    /* 300 buffers take the 8 bit head and tail past 255 */
+    BufferQueueTestStart();
+    for(round = 0U; round < 100U; round ++)
+    {
+        size_t wireStart = usartHost.wireCount;
+        uint32_t eventStart = completeEvents;
+
+        for(index = 0U; index < 3U; index ++)
+        {
+            DRV_USART0_BufferAddWrite(&handles[index], buffers[index], sizeof(buffers[index]));
+        }
+        UsartHostRunUntilIdle(200U);
+
+        for(index = 0U; index < 3U; index ++)
+        {
+            inOrder = inOrder && (completed[eventStart + index] == handles[index]);
+            wireOk = wireOk && (memcmp(&usartHost.wire[wireStart + (index * sizeof(buffers[index]))],
+                                       buffers[index], sizeof(buffers[index])) == 0);
+        }
+        usartHost.wireCount = 0U;
+    }
+
+    HOST_CHECK(completeEvents == 300U);
+    HOST_CHECK(inOrder);
+    HOST_CHECK(wireOk);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+}
+
+static void BufferQueueTestChain(void)
+{
+    DRV_USART_BUFFER_HANDLE handle;
+    uint32_t index;
+    bool wireOk = true;
+
+    BufferQueueTestStart();
+    chainRemaining = 9U;
+    DRV_USART0_BufferAddWrite(&handle, chainBuffer, sizeof(chainBuffer) - 1U);
+
+    HOST_CHECK(UsartHostRunUntilIdle(2000U));
+    HOST_CHECK(completeEvents == 10U);
+    HOST_CHECK(usartHost.wireCount == (10U * (sizeof(chainBuffer) - 1U)));
+    for(index = 0U; index < 10U; index ++)
+    {
+        wireOk = wireOk && (memcmp(&usartHost.wire[index * (sizeof(chainBuffer) - 1U)],
+                                   chainBuffer, sizeof(chainBuffer) - 1U) == 0);
+    }
+    HOST_CHECK(wireOk);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+}
+
+static void BufferQueueTestRingBehind(void)
+{
+    static char buffer[] = "buffer queued first, it leaves before the ring record\r\n";
+    static const char record[] = "ring\r\n";
+    DRV_USART_BUFFER_HANDLE handle;
+    bool interruptState;
+
+    BufferQueueTestStart();
+    interruptState = SYS_INT_Disable();
+    DRV_USART0_BufferAddWrite(&handle, buffer, sizeof(buffer) - 1U);
+    HOST_CHECK(DRV_USART0_TxRingWrite(record, sizeof(record) - 1U) == (sizeof(record) - 1U));
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(usartHost.wireCount == (sizeof(buffer) + sizeof(record) - 2U));
+    HOST_CHECK(memcmp(usartHost.wire, buffer, sizeof(buffer) - 1U) == 0);
+    HOST_CHECK(memcmp(&usartHost.wire[sizeof(buffer) - 1U], record, sizeof(record) - 1U) == 0);
+    HOST_CHECK(completeEvents == 1U);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+}
+
+static void BufferQueueTestReadFull(void)
+{
+    static uint8_t buffers[DRV_USART_RCV_QUEUE_SIZE_IDX0 + 1U][8];
+    DRV_USART_BUFFER_HANDLE handle;
+    uint32_t index;
+
+    BufferQueueTestStart();
+    for(index = 0U; index < DRV_USART_RCV_QUEUE_SIZE_IDX0; index ++)
+    {
+        DRV_USART0_BufferAddRead(&handle, buffers[index], sizeof(buffers[index]));
+        HOST_CHECK(handle != DRV_USART_BUFFER_HANDLE_INVALID);
+    }
+    DRV_USART0_BufferAddRead(&handle, buffers[index], sizeof(buffers[index]));
+    HOST_CHECK(handle == DRV_USART_BUFFER_HANDLE_INVALID);
+}
+
+int main(void)
+{
+    BufferQueueTestFull();
+    BufferQueueTestWrap();
+    BufferQueueTestChain();
+    BufferQueueTestRingBehind();
+    BufferQueueTestReadFull();
+
+    return UsartHostResult("BufferQueueTest");
+}
@@ -0,0 +1,200 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : DmaBlockTest.c
+
+  Summary     : Transmit DMA path of the UART5 driver on the register model.
+
+  Description : Sends write queue buffers longer than one DMA block and
+                checks that they arrive in full, that no block exceeds the
+                8 bit DCHxSSIZ and that a transmit ring record queued while
+                the channel runs follows the buffer without overrunning the
+                FIFO. Also aborts the write queue while the channel runs
+                and checks that the buffers fail and are not read again, and
+                that a baud rate change while the channel or the FIFO is busy
+                times out without touching the rate or the data.
+ */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+static uint32_t completeEvents;
+static uint32_t errorEvents;
+
+static void DmaBlockTestEvent(DRV_USART_BUFFER_EVENT event, DRV_USART_BUFFER_HANDLE handle, uintptr_t context)
+{
+    if(event == DRV_USART_BUFFER_EVENT_COMPLETE)
+    {
+        completeEvents ++;
+    }
+    else
+    {
+        errorEvents ++;
+    }
+}
+
+static void DmaBlockTestStart(void)
+{
+    UsartHostReset();
+    DRV_USART0_Initialize();
+    DRV_USART0_BufferEventHandlerSet(DmaBlockTestEvent, 0U);
+    completeEvents = 0U;
+    errorEvents = 0U;
+}
+
+/* One buffer of `size` bytes, sent in `blocks` channel blocks */
+static void DmaBlockTestBuffer(size_t size, uint32_t blocks)
+{
+    static uint8_t buffer[1500];
+    DRV_USART_BUFFER_HANDLE handle;
+    size_t i;
+
+    for(i = 0U; i < size; i ++)
+    {
+        buffer[i] = (uint8_t)(i * 7U + 1U);
+    }
+
+    DmaBlockTestStart();
+    DRV_USART0_BufferAddWrite(&handle, buffer, size);
+    HOST_CHECK(handle != DRV_USART_BUFFER_HANDLE_INVALID);
+    UsartHostService();
+
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.wireCount == size);
+    HOST_CHECK(memcmp(usartHost.wire, buffer, size) == 0);
+    HOST_CHECK(usartHost.dmaBlocks == blocks);
+    HOST_CHECK(usartHost.dmaBlockMax <= 256U);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(completeEvents == 1U);
+    HOST_CHECK(errorEvents == 0U);
+}
+
+/* A ring record published while the channel owns the FIFO */
+static void DmaBlockTestRingAfterBuffer(void)
+{
+    static uint8_t buffer[600];
+    static const char record[] = "ring record behind the DMA buffer\r\n";
+    DRV_USART_BUFFER_HANDLE handle;
+
+    memset(buffer, 'D', sizeof(buffer));
+
+    DmaBlockTestStart();
+    DRV_USART0_BufferAddWrite(&handle, buffer, sizeof(buffer));
+    UsartHostService();
+    UsartHostRun(100U);
+    HOST_CHECK(DRV_USART0_TxRingWrite(record, sizeof(record) - 1U) == (sizeof(record) - 1U));
+    UsartHostService();
+
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(usartHost.wireCount == (sizeof(buffer) + sizeof(record) - 1U));
+    HOST_CHECK(memcmp(usartHost.wire, buffer, sizeof(buffer)) == 0);
+    HOST_CHECK(memcmp(&usartHost.wire[sizeof(buffer)], record, sizeof(record) - 1U) == 0);
+    HOST_CHECK(completeEvents == 1U);
+}
+
+/* Abort while the channel is in the middle of a buffer with another queued */
+static void DmaBlockTestAbort(void)
+{
+    static uint8_t first[1500];
+    static uint8_t second[100];
+    static const char record[] = "ring record after the abort\r\n";
+    DRV_USART_BUFFER_HANDLE handle;
+    size_t wireAtAbort;
+    size_t fifoAtAbort;
+
+    memset(first, '1', sizeof(first));
+    memset(second, '2', sizeof(second));
+
+    DmaBlockTestStart();
+    DRV_USART0_BufferAddWrite(&handle, first, sizeof(first));
+    DRV_USART0_BufferAddWrite(&handle, second, sizeof(second));
+    UsartHostService();
+    UsartHostRun(300U);
+
+    wireAtAbort = usartHost.wireCount;
+    DRV_USART0_BufferAbortWrite();
+    fifoAtAbort = UsartHostTxFifoCount();
+    HOST_CHECK(errorEvents == 2U);
+    HOST_CHECK(completeEvents == 0U);
+
+    /* Only what was already in the FIFO leaves, the buffers are not read again */
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.wireCount == (wireAtAbort + fifoAtAbort));
+
+    /* The rings and the write queue carry on */
+    usartHost.wireCount = 0U;
+    HOST_CHECK(DRV_USART0_TxRingWrite(record, sizeof(record) - 1U) == (sizeof(record) - 1U));
+    DRV_USART0_BufferAddWrite(&handle, second, sizeof(second));
+    HOST_CHECK(handle != DRV_USART_BUFFER_HANDLE_INVALID);
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.wireCount == (sizeof(record) - 1U + sizeof(second)));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(completeEvents == 1U);
+    HOST_CHECK(errorEvents == 2U);
+}
+
+/* DRV_USART0_BaudSet while data is still leaving. Time does not pass on the
+   model inside the driver, so the transmitter never goes idle there. */
+static void DmaBlockTestBaudSetBusy(void)
+{
+    static uint8_t buffer[1500];
+    static const char record[] = "ring record in the FIFO\r\n";
+    DRV_USART_BUFFER_HANDLE handle;
+    DRV_USART_BAUD_STATUS before;
+    DRV_USART_BAUD_STATUS after;
+
+    memset(buffer, 'b', sizeof(buffer));
+
+    /* Channel running */
+    DmaBlockTestStart();
+    DRV_USART0_BaudStatusGet(&before);
+    DRV_USART0_BufferAddWrite(&handle, buffer, sizeof(buffer));
+    UsartHostService();
+    UsartHostRun(50U);
+
+    HOST_CHECK(DRV_USART0_BaudSet(9600U) == DRV_USART_BAUD_SET_TIMEOUT);
+    DRV_USART0_BaudStatusGet(&after);
+    HOST_CHECK(after.requested == before.requested);
+    HOST_CHECK(after.brg == before.brg);
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.wireCount == sizeof(buffer));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(completeEvents == 1U);
+
+    /* Only the FIFO busy, the transmit source must come back by itself */
+    DmaBlockTestStart();
+    HOST_CHECK(DRV_USART0_TxRingWrite(record, sizeof(record) - 1U) == (sizeof(record) - 1U));
+    UsartHostService();
+    HOST_CHECK(UsartHostTxFifoCount() != 0U);
+
+    HOST_CHECK(DRV_USART0_BaudSet(9600U) == DRV_USART_BAUD_SET_TIMEOUT);
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(usartHost.wireCount == (sizeof(record) - 1U));
+
+    /* Idle now, the change goes through */
+    HOST_CHECK(DRV_USART0_BaudSet(9600U) == DRV_USART_BAUD_SET_SUCCESS);
+    DRV_USART0_BaudStatusGet(&after);
+    HOST_CHECK(after.requested == 9600U);
+}
+
+int main(void)
+{
+    DmaBlockTestBuffer(100U, 1U);
+    DmaBlockTestBuffer(256U, 1U);
+    DmaBlockTestBuffer(257U, 2U);
+    DmaBlockTestBuffer(1500U, 6U);
+    DmaBlockTestRingAfterBuffer();
+    DmaBlockTestAbort();
+    DmaBlockTestBaudSetBusy();
+
+    return UsartHostResult("DmaBlockTest");
+}
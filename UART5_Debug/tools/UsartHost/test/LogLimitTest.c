@@ -0,0 +1,117 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : LogLimitTest.c
+
+  Summary     : Rate limit summaries of log call sites on the register model.
+
+  Description : Repeats an error and a plain print past their burst, lets the
+                window end and checks that AppLogLimitTasks reports each
+                site once, on the lane of its level, without the site having
+                to fire again. Also checks that a site firing again after its
+                window reports ahead of its message and is not reported a
+                second time by AppLogLimitTasks.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+#define LOG_LIMIT_TEST_REPEATS      10U
+#define LOG_LIMIT_TEST_SUMMARY      "last message repeated 6 times"
+
+static void LogLimitTestError(void)
+{
+    LOGGING_ERROR("sensor lost");
+}
+
+static void LogLimitTestPrint(void)
+{
+    APP_LOG_RATE_LIMITED(AppDebugPrint("plain line\r\n"));
+}
+
+static uint32_t LogLimitTestRecords(DRV_USART_TX_LANE lane)
+{
+    DRV_USART_TX_RING_STATUS status;
+
+    DRV_USART0_TxRingStatusGet(lane, &status);
+    return status.recordCount;
+}
+
+/* Occurrences of `text` on the wire since the last call */
+static uint32_t LogLimitTestWire(const char *text)
+{
+    static char wire[sizeof(usartHost.wire) + 1U];
+    const char *cursor = wire;
+    uint32_t found = 0U;
+
+    HOST_CHECK(UsartHostRunUntilIdle(20000U));
+    memcpy(wire, usartHost.wire, usartHost.wireCount);
+    wire[usartHost.wireCount] = '\0';
+    usartHost.wireCount = 0U;
+
+    while((cursor = strstr(cursor, text)) != NULL)
+    {
+        found ++;
+        cursor += strlen(text);
+    }
+    return found;
+}
+
+int main(void)
+{
+    uint32_t high;
+    uint32_t normal;
+    uint32_t index;
+
+    UsartHostReset();
+    DRV_USART0_Initialize();
+
+    for(index = 0U; index < LOG_LIMIT_TEST_REPEATS; index ++)
+    {
+        LogLimitTestError();
+        LogLimitTestPrint();
+    }
+    HOST_CHECK(LogLimitTestWire("sensor lost") == APP_LOG_RATE_BURST);
+
+    /* Window still open, nothing to report */
+    AppLogLimitTasks();
+    HOST_CHECK(LogLimitTestWire(LOG_LIMIT_TEST_SUMMARY) == 0U);
+
+    /* Both sites went quiet, their summaries come from the task */
+    UsartHostCoreTimerAdvance(APP_LOG_RATE_WINDOW_TICKS);
+    high = LogLimitTestRecords(DRV_USART_TX_LANE_HIGH);
+    normal = LogLimitTestRecords(DRV_USART_TX_LANE_NORMAL);
+    AppLogLimitTasks();
+    HOST_CHECK(LogLimitTestRecords(DRV_USART_TX_LANE_HIGH) == (high + 1U));
+    HOST_CHECK(LogLimitTestRecords(DRV_USART_TX_LANE_NORMAL) == (normal + 1U));
+    HOST_CHECK(LogLimitTestWire(LOG_LIMIT_TEST_SUMMARY) == 2U);
+
+    AppLogLimitTasks();
+    HOST_CHECK(LogLimitTestWire(LOG_LIMIT_TEST_SUMMARY) == 0U);
+
+    /* The site fires again after its window: summary first, once */
+    for(index = 0U; index < LOG_LIMIT_TEST_REPEATS; index ++)
+    {
+        LogLimitTestError();
+    }
+    UsartHostCoreTimerAdvance(APP_LOG_RATE_WINDOW_TICKS);
+    LogLimitTestError();
+    AppLogLimitTasks();
+    HOST_CHECK(LogLimitTestWire(LOG_LIMIT_TEST_SUMMARY) == 1U);
+
+    /* The new window has its own burst and nothing dropped */
+    UsartHostCoreTimerAdvance(APP_LOG_RATE_WINDOW_TICKS);
+    AppLogLimitTasks();
+    HOST_CHECK(LogLimitTestWire("last message repeated") == 0U);
+
+    return UsartHostResult("LogLimitTest");
+}
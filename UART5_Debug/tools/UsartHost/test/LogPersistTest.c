@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : LogPersistTest.c
+
+  Summary     : Replay of the persistent log ring on the register model.
+
+  Description : Fills the ring past its size with numbered records, replays
+                it as after a reset while a live record is queued on the
+                high priority lane between replay calls, and checks that
+                every record that survived comes out whole and in order.
+                Also checks that the reset cause flags are cleared.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+#define LOG_PERSIST_TEST_RECORDS    60U
+#define LOG_PERSIST_TEST_LIVE       "LIVE\r\n"
+
+/* Record `number`: "<NN" and a filler of a length that varies, then ">" */
+static size_t LogPersistTestRecord(uint32_t number, char *record)
+{
+    size_t length = 3U;
+    size_t filler = 20U + ((number * 37U) % 90U);
+
+    record[0] = '<';
+    record[1] = (char)('0' + ((number / 10U) % 10U));
+    record[2] = (char)('0' + (number % 10U));
+    while(filler > 0U)
+    {
+        record[length] = (char)('a' + (length % 26U));
+        length ++;
+        filler --;
+    }
+    record[length] = '>';
+    return length + 1U;
+}
+
+static void LogPersistTestLive(void)
+{
+    char *record = UartTxReserveHigh((int)(sizeof(LOG_PERSIST_TEST_LIVE) - 1U));
+
+    if(record != NULL)
+    {
+        memcpy(record, LOG_PERSIST_TEST_LIVE, sizeof(LOG_PERSIST_TEST_LIVE) - 1U);
+        (void)UartTxCommit((int)(sizeof(LOG_PERSIST_TEST_LIVE) - 1U));
+    }
+}
+
+int main(void)
+{
+    static char wire[sizeof(usartHost.wire) + 1U];
+    char record[128];
+    size_t length;
+    size_t kept = 0U;
+    uint32_t first = LOG_PERSIST_TEST_RECORDS;
+    uint32_t number;
+    uint32_t calls = 0U;
+    const char *cursor;
+
+    UsartHostReset();
+    DRV_USART0_Initialize();
+
+    /* Power on: the ring is not valid and is cleared */
+    AppLogPersistInitialize();
+    HOST_CHECK(!AppLogPersistReplayPending());
+
+    for(number = 0U; number < LOG_PERSIST_TEST_RECORDS; number ++)
+    {
+        length = LogPersistTestRecord(number, record);
+        AppLogPersistWrite(record, length);
+    }
+
+    /* The newest records that fit, each with its two length bytes */
+    while(first > 0U)
+    {
+        length = LogPersistTestRecord(first - 1U, record) + 2U;
+        if((kept + length) > APP_LOG_PERSIST_SIZE)
+        {
+            break;
+        }
+        kept += length;
+        first --;
+    }
+    HOST_CHECK(first > 0U);
+
+    /* Reset by the watchdog */
+    RCON = _RCON_WDTO_MASK;
+    RCONCLR = 0U;
+    AppLogPersistInitialize();
+    HOST_CHECK(AppLogPersistReplayPending());
+    HOST_CHECK((RCONCLR & _RCON_WDTO_MASK) != 0U);
+    HOST_CHECK((RCONCLR & _RCON_POR_MASK) != 0U);
+
+    while(!AppLogPersistReplayTasks() && (calls < 1000U))
+    {
+        LogPersistTestLive();
+        UsartHostRun(20U);
+        calls ++;
+    }
+    HOST_CHECK(!AppLogPersistReplayPending());
+    HOST_CHECK(UsartHostRunUntilIdle(20000U));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+
+    memcpy(wire, usartHost.wire, usartHost.wireCount);
+    wire[usartHost.wireCount] = '\0';
+    HOST_CHECK(strstr(wire, "RCON 0x00000010") != NULL);
+
+    /* Every record after the oldest one kept, whole and in order */
+    cursor = wire;
+    for(number = first; number < LOG_PERSIST_TEST_RECORDS; number ++)
+    {
+        length = LogPersistTestRecord(number, record);
+        record[length] = '\0';
+        cursor = strstr(cursor, record);
+        if(!HOST_CHECK(cursor != NULL))
+        {
+            printf("record %u not found whole\n", (unsigned)number);
+            break;
+        }
+        cursor += length;
+    }
+    HOST_CHECK(strstr(wire, "END OF LOG BEFORE RESET") != NULL);
+
+    /* A record written after the replay belongs to the new session */
+    length = LogPersistTestRecord(99U, record);
+    AppLogPersistWrite(record, length);
+    AppLogPersistInitialize();
+    HOST_CHECK(AppLogPersistReplayPending());
+
+    return UsartHostResult("LogPersistTest");
+}
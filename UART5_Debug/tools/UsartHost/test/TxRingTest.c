@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : TxRingTest.c
+
+  Summary     : Transmit rings of the UART5 driver on the register model.
+
+  Description : Checks that records written with DRV_USART0_TxLaneWrite leave
+                in order and without FIFO overruns, that the high priority
+                lane overtakes queued normal records, that a full lane drops
+                whole records and counts them, that the high water mark
+                holds the peak, and that records wrap around the end of the
+                lane intact.
+ */
+/* ************************************************************************** */
+
+#include <stdio.h>
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+static void TxRingTestStart(void)
+{
+    UsartHostReset();
+    DRV_USART0_Initialize();
+}
+
+static bool TxRingTestWire(const char *expected)
+{
+    size_t length = strlen(expected);
+
+    return (usartHost.wireCount == length) && (memcmp(usartHost.wire, expected, length) == 0);
+}
+
+static void TxRingTestOrder(void)
+{
+    DRV_USART_TX_RING_STATUS status;
+
+    TxRingTestStart();
+    HOST_CHECK(DRV_USART0_TxRingWrite("one\r\n", 5U) == 5U);
+    HOST_CHECK(DRV_USART0_TxRingWrite("two, a little longer\r\n", 22U) == 22U);
+    HOST_CHECK(DRV_USART0_TxRingWrite("three\r\n", 7U) == 7U);
+
+    HOST_CHECK(UsartHostRunUntilIdle(200U));
+    HOST_CHECK(TxRingTestWire("one\r\ntwo, a little longer\r\nthree\r\n"));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(DRV_USART0_TxRingIsEmpty());
+
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &status);
+    HOST_CHECK(status.used == 0U);
+    HOST_CHECK(status.recordCount == 3U);
+    HOST_CHECK(status.dropCount == 0U);
+}
+
+static void TxRingTestPriority(void)
+{
+    static const char normal[] = "normal record that fills more than one FIFO burst\r\n";
+    static const char high[] = "HIGH\r\n";
+    bool interruptState;
+    const char *highOnWire;
+
+    TxRingTestStart();
+    interruptState = SYS_INT_Disable();
+    HOST_CHECK(DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE_NORMAL, normal, sizeof(normal) - 1U) != 0U);
+    HOST_CHECK(DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE_NORMAL, normal, sizeof(normal) - 1U) != 0U);
+    HOST_CHECK(DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE_HIGH, high, sizeof(high) - 1U) != 0U);
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(usartHost.wireCount == ((2U * (sizeof(normal) - 1U)) + sizeof(high) - 1U));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+
+    /* Queued before any byte left, so it goes first */
+    highOnWire = (const char *)usartHost.wire;
+    HOST_CHECK(memcmp(highOnWire, high, sizeof(high) - 1U) == 0);
+}
+
+static void TxRingTestDrop(void)
+{
+    static char record[100];
+    DRV_USART_TX_RING_STATUS status;
+    bool interruptState;
+    uint32_t accepted = 0U;
+    uint32_t index;
+
+    memset(record, 'n', sizeof(record));
+
+    /* Nothing drains while interrupts are masked, ten records with their
+       two byte headers fill 1020 of the 1024 bytes */
+    TxRingTestStart();
+    interruptState = SYS_INT_Disable();
+    for(index = 0U; index < 12U; index ++)
+    {
+        if(DRV_USART0_TxLaneWrite(DRV_USART_TX_LANE_NORMAL, record, sizeof(record)) == sizeof(record))
+        {
+            accepted ++;
+        }
+    }
+
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &status);
+    HOST_CHECK(accepted == (DRV_USART_TX_RING_SIZE_IDX0 / (sizeof(record) + 2U)));
+    HOST_CHECK(status.recordCount == accepted);
+    HOST_CHECK(status.dropCount == (12U - accepted));
+    HOST_CHECK(status.dropBytes == ((12U - accepted) * sizeof(record)));
+    HOST_CHECK(status.used == (accepted * (sizeof(record) + 2U)));
+    HOST_CHECK(status.highWater == status.used);
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(UsartHostRunUntilIdle(2000U));
+    HOST_CHECK(usartHost.wireCount == (accepted * sizeof(record)));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+
+    /* The peak stays, the occupancy is back to zero */
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &status);
+    HOST_CHECK(status.used == 0U);
+    HOST_CHECK(status.highWater == (accepted * (sizeof(record) + 2U)));
+}
+
+static void TxRingTestWrap(void)
+{
+    static uint8_t expected[sizeof(usartHost.wire)];
+    char record[40];
+    size_t expectedCount = 0U;
+    uint32_t index;
+    int length;
+
+    /* 37 to 39 byte records go round the 1024 byte lane several times while
+       the interrupt drains it, so records start at every alignment */
+    TxRingTestStart();
+    for(index = 0U; index < 150U; index ++)
+    {
+        length = snprintf(record, sizeof(record), "record %03u .......................%*s\r\n",
+                          (unsigned)index, (int)(index % 3U), "");
+        if(DRV_USART0_TxRingWrite(record, (size_t)length) == (size_t)length)
+        {
+            memcpy(&expected[expectedCount], record, (size_t)length);
+            expectedCount += (size_t)length;
+        }
+        UsartHostRun(20U);
+    }
+
+    HOST_CHECK(UsartHostRunUntilIdle(4000U));
+    HOST_CHECK(expectedCount > (3U * DRV_USART_TX_RING_SIZE_IDX0));
+    HOST_CHECK(usartHost.wireCount == expectedCount);
+    HOST_CHECK(memcmp(usartHost.wire, expected, expectedCount) == 0);
+    HOST_CHECK(usartHost.txOverruns == 0U);
+}
+
+static void TxRingTestAfterDirectWrite(void)
+{
+    char direct[] = "12345678";
+
+    /* DRV_USART0_Write fills the FIFO itself; the flag latched while it was
+       empty must not let the ring burst on top of it */
+    TxRingTestStart();
+    HOST_CHECK(DRV_USART0_Write(direct, 8U) == 8U);
+    HOST_CHECK(DRV_USART0_TxRingWrite("ring\r\n", 6U) == 6U);
+
+    HOST_CHECK(UsartHostRunUntilIdle(200U));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+    HOST_CHECK(TxRingTestWire("12345678ring\r\n"));
+}
+
+int main(void)
+{
+    TxRingTestOrder();
+    TxRingTestPriority();
+    TxRingTestDrop();
+    TxRingTestWrap();
+    TxRingTestAfterDirectWrite();
+
+    return UsartHostResult("TxRingTest");
+}
@@ -0,0 +1,143 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : UartAsyncTest.c
+
+  Summary     : UartWritePacketAsync completions on the register model.
+
+  Description : Checks that a packet's callback runs once with SUCCESS after
+                the packet left, that buffers other clients queue with the
+                driver (a write buffer, a read buffer failing on a receive
+                error) neither complete a packet early nor call a callback,
+                and that an aborted packet reports e_ERROR_FAILED_WRITE_UART.
+ */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+static uint32_t callbackCount;
+static int8_t callbackStatus;
+static uintptr_t callbackContext;
+static size_t wireAtCallback;
+
+static void UartAsyncTestCallback(int8_t status, uintptr_t context)
+{
+    callbackCount ++;
+    callbackStatus = status;
+    callbackContext = context;
+    wireAtCallback = usartHost.wireCount;
+}
+
+/* The driver is initialized once, as on the target: the HAL sets its event
+   handler on the first packet only. Every case leaves the driver idle. */
+static void UartAsyncTestStart(void)
+{
+    usartHost.wireCount = 0U;
+    callbackCount = 0U;
+    callbackStatus = SUCCESS;
+    callbackContext = 0U;
+    wireAtCallback = 0U;
+}
+
+static void UartAsyncTestComplete(void)
+{
+    static char packet[] = "async packet\r\n";
+
+    UartAsyncTestStart();
+    HOST_CHECK(UartWritePacketAsync(packet, sizeof(packet) - 1, UartAsyncTestCallback, 7U) == SUCCESS);
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+
+    HOST_CHECK(callbackCount == 1U);
+    HOST_CHECK(callbackStatus == SUCCESS);
+    HOST_CHECK(callbackContext == 7U);
+    HOST_CHECK(UartWritePacketPending() == 0U);
+    HOST_CHECK(usartHost.wireCount == (sizeof(packet) - 1U));
+}
+
+static void UartAsyncTestForeignWrite(void)
+{
+    static char foreign[] = "queued with the driver directly, long enough to take a while\r\n";
+    static char packet[] = "async packet\r\n";
+    DRV_USART_BUFFER_HANDLE handle;
+    bool interruptState;
+
+    /* The foreign buffer completes first and must not end the packet */
+    UartAsyncTestStart();
+    interruptState = SYS_INT_Disable();
+    DRV_USART0_BufferAddWrite(&handle, foreign, sizeof(foreign) - 1U);
+    HOST_CHECK(UartWritePacketAsync(packet, sizeof(packet) - 1, UartAsyncTestCallback, 9U) == SUCCESS);
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(UsartHostRunUntilIdle(800U));
+    HOST_CHECK(callbackCount == 1U);
+    HOST_CHECK(callbackStatus == SUCCESS);
+    HOST_CHECK(callbackContext == 9U);
+    HOST_CHECK(wireAtCallback >= (sizeof(foreign) - 1U + sizeof(packet) - 1U - 8U));
+    HOST_CHECK(UartWritePacketPending() == 0U);
+}
+
+static void UartAsyncTestReadError(void)
+{
+    static char packet[] = "packet sent while a read fails\r\n";
+    static uint8_t readBuffer[4];
+    DRV_USART_BUFFER_HANDLE handle;
+    bool interruptState;
+
+    UartAsyncTestStart();
+    DRV_USART0_BufferAddRead(&handle, readBuffer, sizeof(readBuffer));
+    HOST_CHECK(handle != DRV_USART_BUFFER_HANDLE_INVALID);
+
+    /* The read error is reported before the packet has left */
+    interruptState = SYS_INT_Disable();
+    HOST_CHECK(UartWritePacketAsync(packet, sizeof(packet) - 1, UartAsyncTestCallback, 3U) == SUCCESS);
+    SYS_INT_SourceStatusSet(INT_SOURCE_USART_5_ERROR);
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(callbackCount == 0U);
+    HOST_CHECK(UartWritePacketPending() == 1U);
+
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(callbackCount == 1U);
+    HOST_CHECK(callbackStatus == SUCCESS);
+    HOST_CHECK(callbackContext == 3U);
+}
+
+static void UartAsyncTestAbort(void)
+{
+    static char packet[] = "packet aborted before it left\r\n";
+    bool interruptState;
+
+    UartAsyncTestStart();
+    interruptState = SYS_INT_Disable();
+    HOST_CHECK(UartWritePacketAsync(packet, sizeof(packet) - 1, UartAsyncTestCallback, 5U) == SUCCESS);
+    DRV_USART0_BufferAbortWrite();
+    SYS_INT_Restore(interruptState);
+
+    HOST_CHECK(callbackCount == 1U);
+    HOST_CHECK(callbackStatus == e_ERROR_FAILED_WRITE_UART);
+    HOST_CHECK(callbackContext == 5U);
+    HOST_CHECK(UartWritePacketPending() == 0U);
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(usartHost.wireCount == 0U);
+}
+
+int main(void)
+{
+    UsartHostReset();
+    DRV_USART0_Initialize();
+
+    UartAsyncTestComplete();
+    UartAsyncTestForeignWrite();
+    UartAsyncTestReadError();
+    UartAsyncTestAbort();
+
+    return UsartHostResult("UartAsyncTest");
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*
+  Company     : BTC POWER.
+
+  Author      : Krushna C
+
+  Created     : 17 October 2026
+
+  File Name   : UartVectorTest.c
+
+  Summary     : Vectored UART5 writes on the register model.
+
+  Description : Sends a header, a payload and a trailer with
+                UartWritePacketV and checks that they leave back to back as
+                one packet (one DMA block when the channel is configured),
+                that UartWriteQueuedV and UartWriteQueuedHighV queue one
+                record on their lane, and the status codes of bad lists.
+ */
+/* ************************************************************************** */
+
+#include <string.h>
+#include "system_config.h"
+#include "system_definitions.h"
+#include "UsartHost.h"
+
+static const char vectorHeader[] = "HDR:";
+static const char vectorTrailer[] = ":END\r\n";
+static char vectorPayload[64];
+
+static void UartVectorTestSegments(UART_SEGMENT *segments)
+{
+    memset(vectorPayload, 'p', sizeof(vectorPayload));
+    segments[0].buffer = vectorHeader;
+    segments[0].length = sizeof(vectorHeader) - 1U;
+    segments[1].buffer = NULL;
+    segments[1].length = 0U;
+    segments[2].buffer = vectorPayload;
+    segments[2].length = sizeof(vectorPayload);
+    segments[3].buffer = vectorTrailer;
+    segments[3].length = sizeof(vectorTrailer) - 1U;
+}
+
+/* True when the wire holds exactly the segments, in order */
+static bool UartVectorTestWire(size_t offset)
+{
+    size_t at = offset;
+
+    if(usartHost.wireCount != (offset + sizeof(vectorHeader) - 1U + sizeof(vectorPayload) + sizeof(vectorTrailer) - 1U))
+    {
+        return false;
+    }
+    if(memcmp(&usartHost.wire[at], vectorHeader, sizeof(vectorHeader) - 1U) != 0)
+    {
+        return false;
+    }
+    at += sizeof(vectorHeader) - 1U;
+    if(memcmp(&usartHost.wire[at], vectorPayload, sizeof(vectorPayload)) != 0)
+    {
+        return false;
+    }
+    at += sizeof(vectorPayload);
+    return (memcmp(&usartHost.wire[at], vectorTrailer, sizeof(vectorTrailer) - 1U) == 0);
+}
+
+static void UartVectorTestPacket(void)
+{
+    UART_SEGMENT segments[4];
+    uint32_t blocks;
+
+    UartVectorTestSegments(segments);
+    usartHost.wireCount = 0U;
+    blocks = usartHost.dmaBlocks;
+
+    HOST_CHECK(UartWritePacketV(segments, 4) == SUCCESS);
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(UartVectorTestWire(0U));
+#if (DRV_USART_SUPPORT_TRANSMIT_DMA == true)
+    HOST_CHECK(usartHost.dmaBlocks == (blocks + 1U));
+#else
+    HOST_CHECK(usartHost.dmaBlocks == blocks);
+#endif
+}
+
+static void UartVectorTestQueued(void)
+{
+    UART_SEGMENT segments[4];
+    DRV_USART_TX_RING_STATUS before;
+    DRV_USART_TX_RING_STATUS after;
+
+    UartVectorTestSegments(segments);
+
+    usartHost.wireCount = 0U;
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &before);
+    HOST_CHECK(UartWriteQueuedV(segments, 4) == SUCCESS);
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_NORMAL, &after);
+    HOST_CHECK(after.recordCount == (before.recordCount + 1U));
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(UartVectorTestWire(0U));
+
+    usartHost.wireCount = 0U;
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_HIGH, &before);
+    HOST_CHECK(UartWriteQueuedHighV(segments, 4) == SUCCESS);
+    DRV_USART0_TxRingStatusGet(DRV_USART_TX_LANE_HIGH, &after);
+    HOST_CHECK(after.recordCount == (before.recordCount + 1U));
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(UartVectorTestWire(0U));
+}
+
+static void UartVectorTestErrors(void)
+{
+    static char large[MAX_FRAME_SIZE];
+    UART_SEGMENT segments[4];
+
+    UartVectorTestSegments(segments);
+    usartHost.wireCount = 0U;
+
+    HOST_CHECK(UartWritePacketV(NULL, 1) == e_ERROR_UART_INVALID_POINTER);
+    HOST_CHECK(UartWritePacketV(segments, -1) == e_ERROR_BUFFER_SIZE_INVALID);
+    HOST_CHECK(UartWritePacketV(&segments[1], 1) == e_NO_DATA);
+
+    segments[1].length = 1U;
+    HOST_CHECK(UartWritePacketV(segments, 4) == e_ERROR_UART_INVALID_POINTER);
+
+    /* One byte short of the limit with the header, at the limit with it */
+    segments[1].buffer = large;
+    segments[1].length = MAX_FRAME_SIZE - 1U - (sizeof(vectorHeader) - 1U);
+    HOST_CHECK(UartWritePacketV(segments, 2) == SUCCESS);
+    segments[1].length ++;
+    HOST_CHECK(UartWritePacketV(segments, 2) == e_ERROR_UART_BUFFER_OVERFLOW);
+
+    HOST_CHECK(UsartHostRunUntilIdle(400U));
+    HOST_CHECK(usartHost.wireCount == (MAX_FRAME_SIZE - 1U));
+    HOST_CHECK(usartHost.txOverruns == 0U);
+}
+
+int main(void)
+{
+    UsartHostReset();
+    DRV_USART0_Initialize();
+
+    UartVectorTestPacket();
+    UartVectorTestQueued();
+    UartVectorTestErrors();
+
+    return UsartHostResult("UartVectorTest");
+}